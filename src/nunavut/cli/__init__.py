@@ -65,6 +65,32 @@ class _NunavutArgumentParser(argparse.ArgumentParser):
                 ).lstrip()
             )
 
+        if args.watch and (
+            args.list_outputs or args.list_inputs or args.list_configuration or args.dry_run or args.no_overwrite
+        ):
+            self.error(
+                textwrap.dedent(
+                    """
+                Logic error: --watch cannot be combined with --list-*, --dry-run, or --no-overwrite
+
+                Watch mode continuously rewrites generated files.
+            """
+                ).lstrip()
+            )
+
+        for rule in args.serialization_direction or []:
+            _, separator, direction = rule.partition("=")
+            if not separator or direction not in ("both", "serialize", "deserialize", "none"):
+                self.error(
+                    textwrap.dedent(
+                        f"""
+                    Invalid --serialization-direction {rule}
+
+                    Expected PATTERN=DIRECTION where DIRECTION is one of both, serialize, deserialize, or none.
+                """
+                    ).lstrip()
+                )
+
 
 def _make_parser() -> argparse.ArgumentParser:
     """
@@ -247,6 +273,24 @@ def _make_parser() -> argparse.ArgumentParser:
         ).lstrip(),
     )
 
+    parser.add_argument(
+        "--watch",
+        action="store_true",
+        help=textwrap.dedent(
+            """
+
+        Generate once and then keep running, regenerating whenever a file under the
+        root namespace, lookup directories, or template directories changes. Only
+        types whose definitions changed, and the types that depend on them, are
+        regenerated (any template change regenerates everything) and only output
+        files whose contents differ are rewritten. Outputs of deleted or renamed
+        definitions are removed. Uses inotify on Linux and polls elsewhere. Stop
+        with Ctrl-C.
+
+    """
+        ).lstrip(),
+    )
+
     parser.add_argument(
         "--generate-namespace-types",
         action="store_true",
@@ -353,6 +397,25 @@ def _make_parser() -> argparse.ArgumentParser:
         ).lstrip(),
     )
 
+    parser.add_argument(
+        "--jobs",
+        "-j",
+        type=int,
+        default=0,
+        help=textwrap.dedent(
+            """
+
+        The maximum number of worker processes used to parse the root namespace and the
+        lookup directories. Where lookup directories are given, each of them is parsed as
+        a namespace of its own, concurrently with the root namespace, and the types are
+        merged before code is generated for the root namespace. 0 (the default) uses one
+        process per namespace up to the number of CPUs. 1 parses every namespace serially
+        in the nnvg process. The output is the same either way.
+
+    """
+        ).lstrip(),
+    )
+
     parser.add_argument(
         "--embed-auditing-info",
         action="store_true",
@@ -473,12 +536,14 @@ def _make_parser() -> argparse.ArgumentParser:
 
     ln_opt_group.add_argument(
         "--target-endianness",
-        choices=["any", "big", "little"],
+        choices=["any", "big", "little", "auto"],
         help=textwrap.dedent(
             """
 
         Specify the endianness of the target hardware. This allows serialization
-        logic to be optimized for different CPU architectures.
+        logic to be optimized for different CPU architectures. Use "auto" to emit both
+        the little-endian and the endianness-agnostic variants and have the compiler
+        select one based on the detected byte order of the target.
 
     """
         ).lstrip(),
@@ -516,6 +581,22 @@ def _make_parser() -> argparse.ArgumentParser:
         ).lstrip(),
     )
 
+    ln_opt_group.add_argument(
+        "--serialization-assert-level",
+        choices=["none", "api", "full"],
+        help=textwrap.dedent(
+            """
+
+        Select the default level of the assertions generated by --enable-serialization-asserts.
+        "api" only checks buffer sizes and offsets on entry to and exit from the generated
+        serialization routines, which is cheap enough to keep in production builds. "full" (the
+        default) also checks every field and every bit-copy operation. The level can be overridden
+        when compiling by defining NUNAVUT_ASSERT_LEVEL to 0 (none), 1 (api), or 2 (full).
+
+    """
+        ).lstrip(),
+    )
+
     ln_opt_group.add_argument(
         "--enable-override-variable-array-capacity",
         action="store_true",
@@ -530,6 +611,95 @@ def _make_parser() -> argparse.ArgumentParser:
         ).lstrip(),
     )
 
+    ln_opt_group.add_argument(
+        "--enable-transport-adapters",
+        action="store_true",
+        help=textwrap.dedent(
+            """
+
+        Instruct the C generator to emit <type>_canard_publish_() and <type>_udpard_publish_()
+        helpers for message types. These serialize into a temporary buffer allocated from the
+        transport's memory resource instead of the stack and push it to the TX queue, which copies
+        it into frames. Each helper is only compiled if canard.h (libcanard v3) or udpard.h
+        (libudpard v1) is included before the generated header.
+
+    """
+        ).lstrip(),
+    )
+
+    ln_opt_group.add_argument(
+        "--enable-trusted-deserialization",
+        action="store_true",
+        help=textwrap.dedent(
+            """
+
+        Instruct the C and C++ generators to also emit <type>_deserialize_trusted_() (C) and
+        deserialize_trusted() (C++). These skip the array length and delimiter header checks and
+        are only safe for buffers known to hold a valid serialized representation, e.g. ones
+        produced by the same application. With --enable-serialization-asserts the skipped checks
+        are asserted instead. An out-of-range union tag is still rejected.
+
+    """
+        ).lstrip(),
+    )
+
+    ln_opt_group.add_argument(
+        "--enable-restrict-qualifiers",
+        action="store_true",
+        help=textwrap.dedent(
+            """
+
+        Instruct the C generator to restrict-qualify the pointer arguments of the generated
+        serialization functions and of the bit-copy helpers in the support header. This lets the
+        compiler keep object fields in registers across stores into the byte buffer. The object,
+        the buffer and the size argument must not overlap. Define NUNAVUT_RESTRICT to nothing when
+        compiling to disable the qualification without regenerating.
+
+    """
+        ).lstrip(),
+    )
+
+    ln_opt_group.add_argument(
+        "--enable-dynamic-variable-arrays",
+        action="store_true",
+        help=textwrap.dedent(
+            """
+
+        Instruct the C generator to store variable-length arrays as a pointer, a count and a
+        capacity instead of inline arrays sized for the DSDL capacity. The storage is taken from
+        a user-supplied NunavutAllocator (allocate and deallocate callbacks, e.g. bound to o1heap)
+        that is passed to the deserialization and randomization functions; deserializers allocate
+        exactly the received number of elements. Instances must be released with
+        <type>_finalize_().
+
+    """
+        ).lstrip(),
+    )
+
+    ln_opt_group.add_argument(
+        "--serialization-direction",
+        action="append",
+        metavar="PATTERN=DIRECTION",
+        help=textwrap.dedent(
+            """
+
+        Select the serialization logic generated for the types whose full name matches PATTERN, a
+        shell-style wildcard matched with and without the type version (e.g. uavcan.node.* or
+        uavcan.node.Heartbeat.1.*). Service request and response types are also matched by the
+        name of their service (e.g. uavcan.node.GetInfo.1.*). DIRECTION is one of both, serialize,
+        deserialize, or none. Use serialize for types a node only sends and deserialize for types
+        it only receives to keep the unused functions out of the generated code. May be repeated;
+        the last matching pattern wins and is applied after any serialization_directions given in
+        a configuration file. Types that are not matched get both. Generation fails if a type needs
+        logic that is excluded for one of its fields. The C support header only leaves out the
+        primitives of a direction if a pattern matching every name (*) rules it out: this is
+        decided from the rules alone, not from the types generated, so uavcan.*=deserialize does
+        not prune it even if every type is in uavcan. The C++ support header is never pruned.
+
+    """
+        ).lstrip(),
+    )
+
     ln_opt_group.add_argument(
         "--language-standard",
         "-std",
@@ -616,8 +786,11 @@ def main() -> int:
     extra_includes += sorted(extra_includes_from_env)
 
     # pylint: disable=import-outside-toplevel
-    from nunavut.cli.runners import ArgparseRunner
+    from nunavut.cli.runners import ArgparseRunner, ArgparseWatchRunner
 
-    runner = ArgparseRunner(args.root_namespace, args, extra_includes)
-    runner.run()
+    if args.watch:
+        ArgparseWatchRunner(args.root_namespace, args, extra_includes).run()
+    else:
+        runner = ArgparseRunner(args.root_namespace, args, extra_includes)
+        runner.run()
     return 0
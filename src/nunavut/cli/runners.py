@@ -7,12 +7,21 @@
     Objects that utilize command-line inputs to run a program using Nunavut.
 """
 import argparse
+import concurrent.futures
+import ctypes
+import logging
+import os
 import pathlib
+import select
+import shutil
 import sys
+import tempfile
+import time
 import typing
 
-from pydsdl import read_namespace as read_dsdl_namespace
+import pydsdl
 
+from nunavut._dependencies import DependencyBuilder
 from nunavut._generators import create_default_generators
 from nunavut._namespace import build_namespace_tree
 from nunavut._postprocessors import (
@@ -23,8 +32,78 @@ from nunavut._postprocessors import (
     SetFileMode,
     TrimTrailingWhitespace,
 )
-from nunavut._utilities import DefaultValue, YesNoDefault
+from nunavut._utilities import TEMPLATE_SUFFIX, DefaultValue, YesNoDefault
+from nunavut.jinja.jinja2 import TemplateError
 from nunavut.lang import Language, LanguageContext, LanguageContextBuilder
+from nunavut.lang._config import LanguageConfig
+
+DSDL_FILE_SUFFIXES = (".dsdl", ".uavcan")
+"""
+The suffixes of the definition files :func:`read_dsdl_namespaces` reads (those :func:`pydsdl.read_namespace` looks for).
+"""
+
+
+def _read_dsdl_namespace_worker(
+    root_namespace: str, lookup_directories: typing.List[str], allow_unregulated_fixed_port_id: bool
+) -> typing.List[pydsdl.CompositeType]:
+    """
+    Module-level entry point for worker processes (must be picklable).
+    """
+    return pydsdl.read_namespace(
+        root_namespace, lookup_directories, allow_unregulated_fixed_port_id=allow_unregulated_fixed_port_id
+    )
+
+
+def read_dsdl_namespaces(
+    root_namespace: str,
+    lookup_directories: typing.List[str],
+    allow_unregulated_fixed_port_id: bool = False,
+    jobs: int = 0,
+) -> typing.List[pydsdl.CompositeType]:
+    """
+    Parse a root namespace and the namespaces in its lookup directories into one merged type list. Without lookup
+    directories this is a single call to :func:`pydsdl.read_namespace`. Otherwise the root namespace and each lookup
+    namespace are read as independent namespaces, each with all the other directories available to resolve its
+    dependencies, and are parsed concurrently in worker processes.
+
+    :param root_namespace: Path to the root namespace folder to parse.
+    :param lookup_directories: Paths to the other DSDL root namespace folders.
+    :param allow_unregulated_fixed_port_id: Passed through to pydsdl.
+    :param jobs: The maximum number of worker processes to use. 0 uses one worker per namespace up to the number of
+        available CPUs. 1 parses every namespace serially in this process.
+    :return: The types of the root namespace followed by the types of each lookup namespace, in the order given. A type
+        that is found in more than one namespace is only listed the first time.
+    """
+    if len(lookup_directories) == 0:
+        return _read_dsdl_namespace_worker(root_namespace, [], allow_unregulated_fixed_port_id)
+
+    namespaces = list({str(pathlib.Path(d).resolve()): d for d in [root_namespace] + lookup_directories}.values())
+    lookups_for_namespace = [namespaces[:index] + namespaces[index + 1 :] for index in range(len(namespaces))]
+
+    max_workers = min(len(namespaces), jobs if jobs > 0 else (os.cpu_count() or 1))
+
+    if max_workers <= 1:
+        type_lists = [
+            _read_dsdl_namespace_worker(namespace, lookups, allow_unregulated_fixed_port_id)
+            for namespace, lookups in zip(namespaces, lookups_for_namespace)
+        ]
+    else:
+        with concurrent.futures.ProcessPoolExecutor(max_workers=max_workers) as executor:
+            futures = [
+                executor.submit(_read_dsdl_namespace_worker, namespace, lookups, allow_unregulated_fixed_port_id)
+                for namespace, lookups in zip(namespaces, lookups_for_namespace)
+            ]
+            type_lists = [future.result() for future in futures]
+
+    merged = []  # type: typing.List[pydsdl.CompositeType]
+    seen = set()  # type: typing.Set[typing.Tuple[str, typing.Tuple[int, int]]]
+    for type_list in type_lists:
+        for dsdl_type in type_list:
+            key = (dsdl_type.full_name, (dsdl_type.version.major, dsdl_type.version.minor))
+            if key not in seen:
+                seen.add(key)
+                merged.append(dsdl_type)
+    return merged
 
 
 class ArgparseRunner:
@@ -35,13 +114,15 @@ class ArgparseRunner:
     :param argparse.Namespace args: The command line arguments.
     :param typing.Optional[typing.Union[str, typing.List[str]]] extra_includes: A list of paths to additional DSDL
         root folders.
+    :param dsdl_types: If provided, these already parsed types are used instead of reading the namespaces.
     """
 
     def __init__(
         self,
-        root_namespace: pathlib.Path,
+        root_namespace: typing.Union[pathlib.Path, str],
         args: argparse.Namespace,
         extra_includes: typing.Optional[typing.Union[str, typing.List[str]]],
+        dsdl_types: typing.Optional[typing.List[pydsdl.CompositeType]] = None,
     ):
         self._args = args
 
@@ -58,11 +139,16 @@ class ArgparseRunner:
         self._language_context = self._create_language_context()
 
         if self._args.generate_support != "only" and not self._args.list_configuration:
-            type_map = read_dsdl_namespace(
-                root_namespace,
-                self._extra_includes,
-                allow_unregulated_fixed_port_id=self._args.allow_unregulated_fixed_port_id,
-            )
+            if dsdl_types is None:
+                dsdl_types = read_dsdl_namespaces(
+                    str(root_namespace),
+                    self._extra_includes,
+                    allow_unregulated_fixed_port_id=self._args.allow_unregulated_fixed_port_id,
+                    jobs=self._args.jobs,
+                )
+            # Types from the lookup namespaces only resolve dependencies; code is generated for the root namespace.
+            root_namespace_name = pathlib.Path(root_namespace).resolve().name
+            type_map = [t for t in dsdl_types if t.root_namespace == root_namespace_name]
         else:
             type_map = []
 
@@ -110,6 +196,27 @@ class ArgparseRunner:
         else:
             self._generate()
 
+    def get_outputs(self) -> typing.List[pathlib.Path]:
+        """
+        :return: The paths of every file :meth:`run` generates with the arguments this object was created with.
+        """
+        outputs = []  # type: typing.List[pathlib.Path]
+        if self._args.generate_support != "only":
+            outputs.extend(self._generator.generate_all(is_dryrun=True))
+
+        if self._should_generate_support():
+            outputs.extend(self._support_generator.generate_all(is_dryrun=True))
+        return outputs
+
+    def get_type_outputs(self) -> typing.Dict[pathlib.Path, pathlib.Path]:
+        """
+        :return: The file :meth:`run` generates for each type, keyed by the resolved path of its definition file.
+        """
+        return {
+            pathlib.Path(dsdl_type.source_file_path).resolve(): output_path
+            for dsdl_type, output_path in self._root_namespace.get_all_datatypes()
+        }
+
     # +---------------------------------------------------------------------------------------------------------------+
     # | PRIVATE
     # +---------------------------------------------------------------------------------------------------------------+
@@ -153,9 +260,23 @@ class ArgparseRunner:
         language_options["enable_serialization_asserts"] = (
             True if self._args.enable_serialization_asserts else DefaultValue(False)
         )
+        if self._args.serialization_assert_level is not None:
+            language_options["serialization_assert_level"] = self._args.serialization_assert_level
         language_options["enable_override_variable_array_capacity"] = (
             True if self._args.enable_override_variable_array_capacity else DefaultValue(False)
         )
+        language_options["enable_transport_adapters"] = (
+            True if self._args.enable_transport_adapters else DefaultValue(False)
+        )
+        language_options["enable_trusted_deserialization"] = (
+            True if self._args.enable_trusted_deserialization else DefaultValue(False)
+        )
+        language_options["enable_restrict_qualifiers"] = (
+            True if self._args.enable_restrict_qualifiers else DefaultValue(False)
+        )
+        language_options["enable_dynamic_variable_arrays"] = (
+            True if self._args.enable_dynamic_variable_arrays else DefaultValue(False)
+        )
         if self._args.language_standard is not None:
             language_options["std"] = self._args.language_standard
 
@@ -173,6 +294,8 @@ class ArgparseRunner:
         )
         builder.set_target_language(target_language_name)
         builder.add_config_files(*additional_config_files)
+        if self._args.serialization_direction is not None:
+            language_options["serialization_directions"] = self._merge_serialization_directions(builder.config)
         builder.set_target_language_extension(self._args.output_extension)
         builder.set_target_language_configuration_override(
             Language.WKCV_NAMESPACE_FILE_STEM, self._args.namespace_output_stem
@@ -183,6 +306,25 @@ class ArgparseRunner:
     # +---------------------------------------------------------------------------------------------------------------+
     # | PRIVATE :: RUN METHODS
     # +---------------------------------------------------------------------------------------------------------------+
+    def _merge_serialization_directions(self, config: LanguageConfig) -> typing.Dict[str, str]:
+        """
+        The last matching serialization direction rule wins so a pattern given again must move to where it was given
+        last. The command line rules are reduced to the last occurrence of each pattern and their patterns are removed
+        from the rules configuration files set for any language. Applying the returned rules as an override then
+        appends them after the remaining configured ones.
+        """
+        rules = {}  # type: typing.Dict[str, str]
+        for rule in self._args.serialization_direction:
+            pattern, direction = rule.split("=", 1)
+            rules.pop(pattern, None)
+            rules[pattern] = direction
+        for section in config.sections().values():
+            configured = section.get(Language.WKCV_LANGUAGE_OPTIONS, {}).get("serialization_directions")
+            if configured is not None:
+                for pattern in rules:
+                    configured.pop(pattern, None)
+        return rules
+
     def _stdout_lister(
         self, things_to_list: typing.Iterable[typing.Any], to_string: typing.Callable[[typing.Any], str]
     ) -> None:
@@ -191,11 +333,7 @@ class ArgparseRunner:
             sys.stdout.write(";")
 
     def _list_outputs_only(self) -> None:
-        if self._args.generate_support != "only":
-            self._stdout_lister(self._generator.generate_all(is_dryrun=True), str)
-
-        if self._should_generate_support():
-            self._stdout_lister(self._support_generator.generate_all(is_dryrun=True), str)
+        self._stdout_lister(self.get_outputs(), str)
 
     def _list_inputs_only(self) -> None:
         if self._args.generate_support != "only":
@@ -248,3 +386,319 @@ class ArgparseRunner:
                 omit_serialization_support=self._args.omit_serialization_support,
                 embed_auditing_info=self._args.embed_auditing_info,
             )
+
+
+# +---------------------------------------------------------------------------------------------------------------+
+# | WATCH MODE
+# +---------------------------------------------------------------------------------------------------------------+
+
+
+class _InotifyWaiter:
+    """
+    Blocks until something changes under a set of directories using Linux inotify (through libc). This is only a
+    wake-up mechanism; :class:`ArgparseWatchRunner` always diffs a snapshot of the watched files to find out what
+    actually changed. Use as a context manager or call :meth:`close` to release the inotify descriptor.
+    """
+
+    # IN_MODIFY | IN_ATTRIB | IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO | IN_CREATE | IN_DELETE
+    _WATCH_MASK = 0x00000002 | 0x00000004 | 0x00000008 | 0x00000040 | 0x00000080 | 0x00000100 | 0x00000200
+
+    @classmethod
+    def create(cls) -> typing.Optional["_InotifyWaiter"]:
+        """
+        :return: A new waiter or None if inotify is not available on this system.
+        """
+        if not sys.platform.startswith("linux"):
+            return None
+        try:
+            libc = ctypes.CDLL(None, use_errno=True)
+            inotify_init1 = libc.inotify_init1
+            inotify_add_watch = libc.inotify_add_watch
+        except (OSError, AttributeError):
+            return None
+        inotify_add_watch.argtypes = [ctypes.c_int, ctypes.c_char_p, ctypes.c_uint32]
+        fd = inotify_init1(os.O_CLOEXEC)
+        if fd < 0:
+            return None
+        return cls(fd, inotify_add_watch)
+
+    def __init__(self, fd: int, inotify_add_watch: typing.Callable[..., int]):
+        self._fd = fd
+        self._inotify_add_watch = inotify_add_watch
+        self._watched = set()  # type: typing.Set[pathlib.Path]
+
+    def __enter__(self) -> "_InotifyWaiter":
+        return self
+
+    def __exit__(self, *_: typing.Any) -> None:
+        self.close()
+
+    def close(self) -> None:
+        """
+        Close the inotify descriptor. Calling this more than once is harmless.
+        """
+        if self._fd >= 0:
+            os.close(self._fd)
+            self._fd = -1
+            self._watched.clear()
+
+    def watch(self, directories: typing.Iterable[pathlib.Path]) -> None:
+        for directory in directories:
+            if directory not in self._watched:
+                if self._inotify_add_watch(self._fd, bytes(directory), self._WATCH_MASK) >= 0:
+                    self._watched.add(directory)
+
+    def wait(self, timeout: float) -> None:
+        readable, _, _ = select.select([self._fd], [], [], timeout)
+        if readable:
+            os.read(self._fd, 65536)
+
+
+class ArgparseWatchRunner:
+    """
+    Runner for ``nnvg --watch``. Monitors the root namespace, lookup directories and template directories and, on
+    each change, regenerates only the types whose definitions changed together with every type that depends on them.
+    Any change to a template regenerates everything. Parsed types are cached per definition file so only the changed
+    files and their dependents are read again. Generation is staged in a temporary directory and only files whose
+    contents differ are copied to the output directory so build systems don't rebuild untouched outputs. Outputs this
+    runner generated that are no longer produced (e.g. because a definition was deleted or renamed) are removed.
+
+    Inotify is used on Linux to wait for changes; other systems fall back to polling.
+
+    :param root_namespace: The root namespace to generate code for.
+    :param argparse.Namespace args: The command line arguments.
+    :param typing.List[str] extra_includes: A list of paths to additional DSDL root folders.
+    """
+
+    POLL_INTERVAL_SEC = 0.5
+    """
+    Interval used to rescan the watched directories when inotify is unavailable. Also the upper bound on how long
+    a change reported by inotify can be missed when events are coalesced.
+    """
+
+    SETTLE_TIME_SEC = 0.05
+    """
+    Time to wait after the first change is detected so that editors that write a file in several steps are seen as
+    a single change.
+    """
+
+    def __init__(
+        self,
+        root_namespace: typing.Union[pathlib.Path, str],
+        args: argparse.Namespace,
+        extra_includes: typing.List[str],
+    ):
+        self._args = args
+        self._extra_includes = extra_includes
+        self._root_dir = pathlib.Path(root_namespace).resolve()
+        self._dsdl_dirs = [self._root_dir] + [pathlib.Path(d).resolve() for d in extra_includes]
+        self._template_dirs = [
+            pathlib.Path(d).resolve() for d in (args.templates, args.support_templates) if d is not None
+        ]
+        self._waiter = _InotifyWaiter.create()
+        self._types = {}  # type: typing.Dict[pathlib.Path, pydsdl.CompositeType]
+        self._dirty = set()  # type: typing.Set[pathlib.Path]
+        self._type_outputs = {}  # type: typing.Dict[pathlib.Path, pathlib.Path]
+        self._shared_outputs = set()  # type: typing.Set[pathlib.Path]
+        self._outputs = set()  # type: typing.Set[pathlib.Path]
+
+    def run(self) -> None:
+        """
+        Generate everything once then regenerate on change until interrupted.
+        """
+        try:
+            snapshot = self._snapshot()
+            self.regenerate(None)
+            while True:
+                changed, snapshot = self._wait_for_changes(snapshot)
+                self.regenerate(changed)
+        except KeyboardInterrupt:
+            pass
+        finally:
+            self.close()
+
+    def close(self) -> None:
+        """
+        Release the resources used to wait for changes.
+        """
+        if self._waiter is not None:
+            self._waiter.close()
+            self._waiter = None
+
+    def regenerate(self, changed: typing.Optional[typing.Set[pathlib.Path]]) -> None:
+        """
+        Bring the output directory up to date.
+
+        :param changed: The files that changed since the last call or None to regenerate every type.
+        """
+        if not self._types:
+            self._dirty.update(self._find_definitions())
+        if changed is not None:
+            self._dirty.update(path for path in changed if path.suffix in DSDL_FILE_SUFFIXES)
+
+        templates_changed = changed is not None and any(self._is_template(path) for path in changed)
+        if templates_changed:
+            logging.info("Templates changed. Regenerating all types.")
+        elif changed is not None:
+            logging.info("DSDL changed: %s", ", ".join(str(path) for path in sorted(changed)))
+
+        # Namespace outputs are built from the whole tree so these builds always regenerate everything.
+        regenerate_all = changed is None or templates_changed or self._args.generate_namespace_types
+
+        try:
+            reread = self._update_types()
+        except pydsdl.FrontendError as e:
+            logging.error("Generation failed (waiting for the next change): %s", e)
+            return
+
+        args = argparse.Namespace(**vars(self._args))
+        if regenerate_all:
+            dsdl_types = list(self._types.values())
+        else:
+            dsdl_types = [self._types[path] for path in reread]
+            args.generate_support = "never"
+
+        outdir = pathlib.Path(self._args.outdir)
+        with tempfile.TemporaryDirectory() as staging_dir:
+            args.outdir = staging_dir
+            try:
+                runner = ArgparseRunner(self._root_dir, args, self._extra_includes, dsdl_types)
+                runner.run()
+            except TemplateError as e:
+                logging.error("Generation failed (waiting for the next change): %s", e)
+                self._dirty.update(reread)
+                return
+            staging = pathlib.Path(staging_dir)
+            updated = self._copy_if_changed(staging, outdir)
+            for path, output_path in runner.get_type_outputs().items():
+                self._type_outputs[path] = (outdir / output_path.relative_to(staging)).resolve()
+            if regenerate_all:
+                # Support and namespace files are only generated by these builds.
+                self._shared_outputs = {
+                    (outdir / staged.relative_to(staging)).resolve()
+                    for staged in staging.rglob("*")
+                    if staged.is_file()
+                } - set(self._type_outputs.values())
+        removed = self._remove_stale_outputs()
+        logging.info("Updated %d file(s), removed %d file(s).", len(updated), len(removed))
+        for path in updated:
+            logging.debug("Updated: %s", path)
+        for path in removed:
+            logging.debug("Removed: %s", path)
+
+    # +---------------------------------------------------------------------------------------------------------------+
+    # | PRIVATE
+    # +---------------------------------------------------------------------------------------------------------------+
+
+    def _is_template(self, path: pathlib.Path) -> bool:
+        return path.suffix == TEMPLATE_SUFFIX and any(
+            template_dir in path.parents for template_dir in self._template_dirs
+        )
+
+    def _find_definitions(self) -> typing.Set[pathlib.Path]:
+        return {path.resolve() for suffix in DSDL_FILE_SUFFIXES for path in self._root_dir.rglob("*" + suffix)}
+
+    def _update_types(self) -> typing.Set[pathlib.Path]:
+        """
+        Read the dirty definition files again together with every cached type that depends on one of them (these
+        hold references to the old definitions). The cache is only modified once pydsdl accepted every file so a
+        failed read is retried on the next change.
+
+        :return: The definition files that were read.
+        """
+        affected = set(self._dirty)
+        for path, dsdl_type in self._types.items():
+            if any(
+                pathlib.Path(dependency.source_file_path).resolve() in self._dirty
+                for dependency in DependencyBuilder(dsdl_type).transitive().composite_types
+            ):
+                affected.add(path)
+
+        # Definitions in lookup directories are only dependencies; they are never generated.
+        to_read = sorted(path for path in affected if path.is_file() and self._root_dir in path.parents)
+        targets = []  # type: typing.List[pydsdl.CompositeType]
+        if len(to_read) > 0:
+            targets, _ = pydsdl.read_files(
+                [str(path) for path in to_read],
+                [str(self._root_dir)],
+                self._extra_includes,
+                allow_unregulated_fixed_port_id=self._args.allow_unregulated_fixed_port_id,
+            )
+
+        for path in affected:
+            self._types.pop(path, None)
+        for dsdl_type in targets:
+            self._types[pathlib.Path(dsdl_type.source_file_path).resolve()] = dsdl_type
+        self._dirty.clear()
+        return set(to_read)
+
+    def _snapshot(self) -> typing.Dict[pathlib.Path, typing.Tuple[int, int]]:
+        snapshot = {}  # type: typing.Dict[pathlib.Path, typing.Tuple[int, int]]
+        directories = []  # type: typing.List[pathlib.Path]
+        for root, suffixes in [(d, DSDL_FILE_SUFFIXES) for d in self._dsdl_dirs] + [
+            (d, (TEMPLATE_SUFFIX,)) for d in self._template_dirs
+        ]:
+            if not root.is_dir():
+                continue
+            directories.append(root)
+            directories.extend(p for p in root.rglob("*") if p.is_dir())
+            for suffix in suffixes:
+                for path in root.rglob("*" + suffix):
+                    if path.is_file():
+                        stat = path.stat()
+                        snapshot[path] = (stat.st_mtime_ns, stat.st_size)
+        if self._waiter is not None:
+            self._waiter.watch(directories)
+        return snapshot
+
+    def _wait_for_changes(
+        self, snapshot: typing.Dict[pathlib.Path, typing.Tuple[int, int]]
+    ) -> typing.Tuple[typing.Set[pathlib.Path], typing.Dict[pathlib.Path, typing.Tuple[int, int]]]:
+        while True:
+            if self._waiter is not None:
+                self._waiter.wait(self.POLL_INTERVAL_SEC)
+            else:
+                time.sleep(self.POLL_INTERVAL_SEC)
+            new_snapshot = self._snapshot()
+            if new_snapshot != snapshot:
+                time.sleep(self.SETTLE_TIME_SEC)
+                new_snapshot = self._snapshot()
+                changed = {
+                    path
+                    for path in set(snapshot) | set(new_snapshot)
+                    if snapshot.get(path) != new_snapshot.get(path)
+                }
+                return (changed, new_snapshot)
+
+    def _remove_stale_outputs(self) -> typing.List[pathlib.Path]:
+        """
+        Delete files this runner generated earlier that the current set of types no longer produces. The expected
+        outputs are those recorded for the definitions still in the type cache plus the support and namespace files of
+        the last full build. Files in the output directory that this runner never generated are left alone.
+        """
+        for path in [path for path in self._type_outputs if path not in self._types]:
+            del self._type_outputs[path]
+        outputs = set(self._type_outputs.values()) | self._shared_outputs
+        stale = sorted(path for path in self._outputs - outputs if path.is_file())
+        for path in stale:
+            path.unlink()
+        self._outputs = outputs
+        return stale
+
+    @staticmethod
+    def _copy_if_changed(staging_dir: pathlib.Path, outdir: pathlib.Path) -> typing.List[pathlib.Path]:
+        updated = []  # type: typing.List[pathlib.Path]
+        for staged in staging_dir.rglob("*"):
+            if not staged.is_file():
+                continue
+            target = outdir / staged.relative_to(staging_dir)
+            if target.exists():
+                if target.read_bytes() == staged.read_bytes():
+                    continue
+                target.chmod(target.stat().st_mode | 0o220)
+            else:
+                target.parent.mkdir(parents=True, exist_ok=True)
+            shutil.copyfile(staged, target)
+            shutil.copymode(staged, target)
+            updated.append(target)
+        return updated
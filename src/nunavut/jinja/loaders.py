@@ -13,8 +13,6 @@ import logging
 import pathlib
 import typing
 
-import pydsdl
-
 from nunavut._utilities import ResourceSearchPolicy, TEMPLATE_SUFFIX
 from nunavut.lang._config import VersionReader
 
@@ -62,7 +60,11 @@ class DSDLTemplateLoader(BaseLoader):
         **kwargs: typing.Any,
     ):
         super().__init__(**kwargs)
-        self._type_to_template_lookup_cache: typing.Dict[pydsdl.Any, pathlib.Path] = dict()
+        # Results of type_to_template keyed by the Python type it was called with, including misses.
+        self._type_to_template_lookup_cache: typing.Dict[typing.Type, typing.Optional[pathlib.Path]] = dict()
+        # Template stem to path maps, built on first use so construction does not touch the file system.
+        self._fs_template_map: typing.Optional[typing.Dict[str, pathlib.Path]] = None
+        self._package_template_map: typing.Optional[typing.Dict[str, pathlib.Path]] = None
 
         if templates_dirs is not None:
             for templates_dir_item in templates_dirs:
@@ -191,7 +193,8 @@ class DSDLTemplateLoader(BaseLoader):
 
     def type_to_template(self, value_type: typing.Type) -> typing.Optional[pathlib.Path]:
         """
-        Given a type object, return a template used to generate code for the type.
+        Given a type object, return a template used to generate code for the type. Results are cached per type
+        for the lifetime of this loader since templates are called for every field of every type being generated.
 
         :return: a template or None if no template could be found for the given type.
 
@@ -206,18 +209,22 @@ class DSDLTemplateLoader(BaseLoader):
             assert template_name.name == 'StructureType.j2'
 
         """
+        try:
+            return self._type_to_template_lookup_cache[value_type]
+        except KeyError:
+            pass
+
         template_path = None
         if self._fsloader is not None:
-            filtered_templates = self._filter_template_list_by_suffix(self._fsloader.list_templates())
-            template_path = self._type_to_template_internal(
-                value_type, dict(map(lambda x: (pathlib.Path(x).stem, pathlib.Path(x)), filtered_templates))
-            )
+            if self._fs_template_map is None:
+                self._fs_template_map = self._make_template_map(self._fsloader)
+            template_path = self._type_to_template_internal(value_type, self._fs_template_map)
         if template_path is None and self._package_loader is not None:
-            filtered_templates = self._filter_template_list_by_suffix(self._package_loader.list_templates())
-            template_path = self._type_to_template_internal(
-                value_type, dict(map(lambda x: (pathlib.Path(x).stem, pathlib.Path(x)), filtered_templates))
-            )
+            if self._package_template_map is None:
+                self._package_template_map = self._make_template_map(self._package_loader)
+            template_path = self._type_to_template_internal(value_type, self._package_template_map)
 
+        self._type_to_template_lookup_cache[value_type] = template_path
         return template_path
 
     # +----------------------------------------------------------------------------------------------------------------+
@@ -227,8 +234,15 @@ class DSDLTemplateLoader(BaseLoader):
     def _filter_template_list_by_suffix(files: typing.List[str]) -> typing.List[str]:
         return [f for f in files if pathlib.Path(f).suffix == TEMPLATE_SUFFIX]
 
+    @classmethod
+    def _make_template_map(cls, loader: BaseLoader) -> typing.Dict[str, pathlib.Path]:
+        return {
+            pathlib.Path(t).stem: pathlib.Path(t) for t in cls._filter_template_list_by_suffix(loader.list_templates())
+        }
+
+    @staticmethod
     def _type_to_template_internal(
-        self, value_type: typing.Type, templates: typing.Mapping[str, pathlib.Path]
+        value_type: typing.Type, templates: typing.Mapping[str, pathlib.Path]
     ) -> typing.Optional[pathlib.Path]:
         search_queue = collections.deque()  # type: typing.Deque[typing.Any]
         discovered = set()  # type: typing.Set[typing.Any]
@@ -237,12 +251,6 @@ class DSDLTemplateLoader(BaseLoader):
 
         while len(search_queue) > 0:
             current_search_type = search_queue.pop()
-            try:
-                template_path = self._type_to_template_lookup_cache[current_search_type]
-                break
-            except KeyError:
-                pass
-
             try:
                 logging.debug(
                     "NunavutTemplateLoader.type_to_template for %s: considering %s...",
@@ -250,7 +258,6 @@ class DSDLTemplateLoader(BaseLoader):
                     current_search_type.__name__,
                 )
                 template_path = templates[current_search_type.__name__]
-                self._type_to_template_lookup_cache[current_search_type] = template_path
                 break
             except KeyError:
                 for base_type in current_search_type.__bases__:
@@ -9,6 +9,7 @@ Language-specific support in nunavut.
 This module contains the Language object and supporting types.
 """
 import abc
+import fnmatch
 import functools
 import importlib
 import logging
@@ -90,6 +91,9 @@ class Language(metaclass=abc.ABCMeta):
     WKCV_LANGUAGE_OPTIONS = "options"
     WKCV_LANGUAGE_OPTION_DEFAULTS = "defaults"
 
+    # Values of the serialization_directions language option. See get_serialization_direction.
+    SERIALIZATION_DIRECTIONS = ("both", "serialize", "deserialize", "none")
+
     @classmethod
     def default_filter_id_for_target(cls, instance: typing.Any) -> str:
         """
@@ -515,6 +519,146 @@ class Language(metaclass=abc.ABCMeta):
         """
         return self._language_options
 
+    def get_serialization_direction(self, t: pydsdl.CompositeType) -> str:
+        """
+        The serialization logic to generate for a type as selected by the ``serialization_directions`` language option:
+        one of ``both``, ``serialize`` (the type is only sent), ``deserialize`` (the type is only received), or
+        ``none``. The option maps shell-style wildcard patterns (see :mod:`fnmatch`) to directions. Each pattern is
+        matched against the full name of the type with and without its version. The request and response types of a
+        service are also matched by the name of their service so ``uavcan.node.GetInfo.1.*`` selects both of them. The
+        last matching pattern wins and types not matched by any pattern get ``both``.
+
+        .. invisible-code-block: python
+
+            from nunavut.lang import Language, LanguageContextBuilder
+            from unittest.mock import MagicMock
+
+            options = {'serialization_directions': {
+                'uavcan.*': 'deserialize',
+                'uavcan.node.Heartbeat.1.*': 'serialize',
+                'uavcan.node.GetInfo.1.*': 'both',
+                'uavcan.node.GetInfo.Request': 'deserialize',
+                'uavcan.register.*': 'none',
+            }}
+
+            lang_c = (
+                LanguageContextBuilder()
+                    .set_target_language("c")
+                    .set_target_language_configuration_override(Language.WKCV_LANGUAGE_OPTIONS, options)
+                    .create()
+                    .get_target_language()
+            )
+
+            def make_type(full_name, has_parent_service=False):
+                t = MagicMock()
+                t.full_name = full_name
+                t.version.major = 1
+                t.version.minor = 0
+                t.has_parent_service = has_parent_service
+                return t
+
+        .. code-block:: python
+
+            assert lang_c.get_serialization_direction(make_type('uavcan.node.Heartbeat')) == 'serialize'
+            assert lang_c.get_serialization_direction(make_type('uavcan.node.GetInfo.Response', True)) == 'both'
+            assert lang_c.get_serialization_direction(make_type('uavcan.node.GetInfo.Request', True)) == 'deserialize'
+            assert lang_c.get_serialization_direction(make_type('uavcan.node.List.Response', True)) == 'deserialize'
+            assert lang_c.get_serialization_direction(make_type('uavcan.register.Value')) == 'none'
+            assert lang_c.get_serialization_direction(make_type('regulated.basics.Primitive')) == 'both'
+
+        :param pydsdl.CompositeType t: The type to look up.
+        :return: The selected direction.
+        :raises TypeError: If the option is not a map.
+        :raises ValueError: If the option names a direction that is not one of the above.
+        """
+        version = f"{t.version.major}.{t.version.minor}"
+        names = [t.full_name, f"{t.full_name}.{version}"]
+        if t.has_parent_service:
+            service_name = t.full_name.rsplit(".", 1)[0]
+            names += [service_name, f"{service_name}.{version}"]
+        selected = "both"
+        for pattern, direction in self._get_serialization_direction_rules():
+            if any(fnmatch.fnmatchcase(name, pattern) for name in names):
+                selected = direction
+        return selected
+
+    def is_serialization_direction_in_use(self, direction: str) -> bool:
+        """
+        If the ``serialization_directions`` language option allows logic for the given direction (``serialize`` or
+        ``deserialize``) to be generated for any type. This only depends on the option so support code, which is
+        generated without the types, can leave out what no type can use. Only a pattern that matches every name
+        (e.g. ``*``) rules out the directions selected before it.
+
+        .. invisible-code-block: python
+
+            from nunavut.lang import Language, LanguageContextBuilder
+
+            def make_language(directions):
+                return (
+                    LanguageContextBuilder()
+                        .set_target_language("c")
+                        .set_target_language_configuration_override(
+                            Language.WKCV_LANGUAGE_OPTIONS, {'serialization_directions': directions})
+                        .create()
+                        .get_target_language()
+                )
+
+        .. code-block:: python
+
+            receiver = make_language({'uavcan.*': 'serialize', '*': 'deserialize'})
+            assert not receiver.is_serialization_direction_in_use('serialize')
+            assert receiver.is_serialization_direction_in_use('deserialize')
+
+            mixed = make_language({'*': 'deserialize', 'uavcan.node.Heartbeat.1.*': 'serialize'})
+            assert mixed.is_serialization_direction_in_use('serialize')
+
+            # Types not matched by any pattern get both.
+            assert make_language({'uavcan.*': 'deserialize'}).is_serialization_direction_in_use('serialize')
+
+        """
+        in_use = {"both"}
+        for pattern, selected in self._get_serialization_direction_rules():
+            if pattern.strip("*") == "":
+                in_use.clear()
+            in_use.add(selected)
+        return bool(in_use & {"both", direction})
+
+    def is_serialization_direction_generated(self, t: pydsdl.CompositeType, direction: str) -> bool:
+        """
+        If logic for the given direction (``serialize`` or ``deserialize``) is generated for a type. See
+        :meth:`get_serialization_direction`. The logic for a composite calls the same logic of the composite types it
+        contains, so the selection for those shall include the direction as well.
+
+        :raises RuntimeError: If the direction is generated for the type but not for a composite type it contains.
+        """
+        if self.get_serialization_direction(t) not in ("both", direction):
+            return False
+        for field in t.fields_except_padding:
+            nested = field.data_type
+            while isinstance(nested, pydsdl.ArrayType):
+                nested = nested.element_type
+            if isinstance(nested, pydsdl.CompositeType) and self.get_serialization_direction(nested) not in (
+                "both",
+                direction,
+            ):
+                raise RuntimeError(
+                    f"{t} needs the {direction} logic of {nested} (field '{field.name}') which is excluded by the "
+                    "serialization_directions option. Add a pattern that selects it for this direction."
+                )
+        return True
+
+    def _get_serialization_direction_rules(self) -> typing.List[typing.Tuple[str, str]]:
+        directions = self.get_option("serialization_directions") or {}
+        if not isinstance(directions, typing.Mapping):
+            raise TypeError(f"serialization_directions must be a map of patterns to directions (is {directions})")
+        for pattern, direction in directions.items():
+            if direction not in self.SERIALIZATION_DIRECTIONS:
+                raise ValueError(
+                    f"Unknown serialization direction '{direction}' for '{pattern}'. "
+                    f"Expected one of {', '.join(self.SERIALIZATION_DIRECTIONS)}."
+                )
+        return list(directions.items())
+
 
 # +---------------------------------------------------------------------------+
 # | UNDEFINED LANGUAGE TYPE (concrete)
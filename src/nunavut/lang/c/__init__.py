@@ -29,6 +29,66 @@ from nunavut.lang._common import IncludeGenerator, TokenEncoder, UniqueNameGener
 from nunavut.lang._language import Language as BaseLanguage
 
 
+class EndiannessVariants:
+    """
+    Callable global, ``endianness_variants``, used as a call block to emit code specialized for little-endian targets
+    (the caller is invoked with ``True``) or for any byte order (``False``) as selected by the ``target_endianness``
+    language option. If the option is ``auto`` both variants are emitted and the selection is made when the generated
+    code is compiled, either by the preprocessor or, if a ``selector`` expression is given, by a branch on that
+    expression. Pass ``depends_on_endianness=False`` where both variants would be identical.
+
+    .. invisible-code-block: python
+
+        from nunavut.lang import Language, LanguageContextBuilder
+
+        def make_lctx(target_endianness):
+            return (
+                LanguageContextBuilder()
+                    .set_target_language("c")
+                    .set_target_language_configuration_override(
+                        Language.WKCV_LANGUAGE_OPTIONS, {'target_endianness': target_endianness}
+                    )
+                    .create()
+            )
+
+    .. code-block:: python
+
+        # Given
+        template = (
+            '{%- call(little_endian) endianness_variants() %}'
+            '{% if little_endian %} le(); {% else %} any(); {% endif %}'
+            '{%- endcall %}'
+        )
+
+        # then
+        rendered_little = ' le(); '
+        rendered_auto = '\\n#if NUNAVUT_TARGET_LITTLE_ENDIAN le(); \\n#else any(); \\n#endif'
+
+    .. invisible-code-block: python
+
+        jinja_filter_tester([], template, rendered_little, make_lctx('little'))
+        jinja_filter_tester([], template, rendered_auto, make_lctx('auto'))
+
+    """
+
+    def __init__(self, target_endianness: str, selector: typing.Optional[str] = None):
+        if target_endianness not in ("any", "big", "little", "auto"):
+            raise ValueError(f"Unsupported target_endianness: {target_endianness}")
+        self._target_endianness = target_endianness
+        self._selector = selector
+
+    def __call__(self, depends_on_endianness: bool = True, caller: typing.Optional[typing.Callable] = None) -> str:
+        if caller is None:
+            raise ValueError("endianness_variants must be used in a call block.")
+        if self._target_endianness == "little":
+            return str(caller(True))
+        if self._target_endianness in ("any", "big") or not depends_on_endianness:
+            return str(caller(False))
+        if self._selector is None:
+            return f"\n#if NUNAVUT_TARGET_LITTLE_ENDIAN{caller(True)}\n#else{caller(False)}\n#endif"
+        return f"\n    if ({self._selector})\n    {{{caller(True)}\n    }}\n    else\n    {{{caller(False)}\n    }}"
+
+
 class Language(BaseLanguage):
     """
     Concrete, C-specific :class:`nunavut.lang.Language` object.
@@ -58,6 +118,10 @@ class Language(BaseLanguage):
         """
         return TokenEncoder(self, stropping_failure_handler=self._handle_stropping_failure)
 
+    def _validate_globals(self, globals_map: typing.Dict[str, typing.Any]) -> typing.Dict[str, typing.Any]:
+        globals_map["endianness_variants"] = EndiannessVariants(str(self.get_option("target_endianness", "any")))
+        return globals_map
+
     def get_includes(self, dep_types: Dependencies) -> typing.List[str]:
         std_includes = []  # type: typing.List[str]
         if self.get_config_value_as_bool("use_standard_types"):
@@ -757,6 +821,20 @@ def filter_to_static_assertion_value(obj: typing.Any) -> int:
 
         jinja_filter_tester(filter_to_static_assertion_value, template, rendered, 'c')
 
+    Maps are converted like the string of their items in order, so an empty map is 0:
+
+    .. code-block:: python
+
+         # given
+        template = '{{ {"uavcan.*": "serialize"} | to_static_assertion_value }} {{ {} | to_static_assertion_value }}'
+
+        # then
+        rendered = '1900932584 0'
+
+    .. invisible-code-block: python
+
+        jinja_filter_tester(filter_to_static_assertion_value, template, rendered, 'c')
+
     """
 
     if isinstance(obj, bool):
@@ -767,6 +845,8 @@ def filter_to_static_assertion_value(obj: typing.Any) -> int:
         from zlib import crc32
 
         return crc32(bytearray(obj, "utf-8"))
+    if isinstance(obj, typing.Mapping):
+        return filter_to_static_assertion_value("".join(f"{key}={value};" for key, value in obj.items()))
 
     raise ValueError("Cannot convert object of type {} into an integer in a stable manner.".format(type(obj)))
 
@@ -973,7 +1053,9 @@ def filter_to_standard_bit_length(t: pydsdl.PrimitiveType) -> int:
 
 
 @template_language_test(__name__)
-def is_zero_cost_primitive(language: Language, t: pydsdl.PrimitiveType) -> bool:
+def is_zero_cost_primitive(
+    language: Language, t: pydsdl.PrimitiveType, little_endian: typing.Optional[bool] = None
+) -> bool:
     """
     Assuming that the target platform is IEEE754-conformant detects whether the native in-memory representation of a
     value of the supplied primitive type is the same as its on-the-wire representation defined by the DSDL
@@ -986,6 +1068,10 @@ def is_zero_cost_primitive(language: Language, t: pydsdl.PrimitiveType) -> bool:
     It follows that arrays, certain composite types, and some other entities composed of zero-cost composites
     are also zero-cost types, but such non-trivial conjectures are not recognized by this function.
 
+    The target byte order is taken from the ``target_endianness`` language option unless ``little_endian`` is given.
+    The latter is used by templates that emit a variant for each byte order when the target endianness is ``auto``
+    (e.g., ``t is zero_cost_primitive(True)``).
+
     Raises a :class:`TypeError` if the argument is not a value of type :class:`pydsdl.PrimitiveType`.
 
     .. invisible-code-block: python
@@ -1045,8 +1131,23 @@ def is_zero_cost_primitive(language: Language, t: pydsdl.PrimitiveType) -> bool:
                             'False False False False False',
                             lctx, i7=i7, u32=u32, f16=f16, f32=f32, bl=bl)
 
+        # with auto endianness the template chooses the byte order to test for.
+        options = {'target_endianness': 'auto'}
+        lctx = (
+            LanguageContextBuilder()
+                .set_target_language("c")
+                .set_target_language_configuration_override(Language.WKCV_LANGUAGE_OPTIONS, options)
+                .create()
+        )
+        jinja_filter_tester(is_zero_cost_primitive,
+                            '{{ u32 is zero_cost_primitive }} {{ u32 is zero_cost_primitive(True) }}',
+                            'False True',
+                            lctx, u32=u32)
+
     """
-    if language.get_option("target_endianness") != "little":
+    if little_endian is None:
+        little_endian = language.get_option("target_endianness") == "little"
+    if not little_endian:
         # We must explicitly target a little endian platform to get
         # zero cost ser/des.
         return False
@@ -1100,3 +1201,171 @@ def filter_is_zero_cost_primitive(language: Language, t: pydsdl.PrimitiveType) -
 
     """
     return str(is_zero_cost_primitive(language, t))
+
+
+@template_language_test(__name__)
+def is_dynamically_allocated(language: Language, t: pydsdl.SerializableType) -> bool:
+    """
+    Detects whether instances of the supplied type own storage obtained from a ``NunavutAllocator``. This is only
+    ever the case if the ``enable_dynamic_variable_arrays`` language option is set, in which case every
+    variable-length array is allocated and so is every array or composite containing one, however deeply nested.
+    Such instances must be released with ``<type>_finalize_()``.
+
+    .. invisible-code-block: python
+
+        from nunavut.lang.c import is_dynamically_allocated
+        import pydsdl
+
+    .. code-block:: python
+
+        # Given
+        u8 = pydsdl.UnsignedIntegerType(8, pydsdl.PrimitiveType.CastMode.TRUNCATED)
+        fixed = pydsdl.FixedLengthArrayType(u8, 4)
+        variable = pydsdl.VariableLengthArrayType(u8, 4)
+
+        # and
+        template = (
+            '{{ u8 is dynamically_allocated }} '
+            '{{ fixed is dynamically_allocated }} '
+            '{{ variable is dynamically_allocated }}'
+        )
+
+        # then, if dynamic variable-length arrays are enabled
+        rendered = 'False False True'
+
+    .. invisible-code-block: python
+
+        options = {'enable_dynamic_variable_arrays': True}
+        lctx = (
+            LanguageContextBuilder()
+                .set_target_language("c")
+                .set_target_language_configuration_override(Language.WKCV_LANGUAGE_OPTIONS, options)
+                .create()
+        )
+        jinja_filter_tester(is_dynamically_allocated, template, rendered, lctx, u8=u8, fixed=fixed, variable=variable)
+
+        # nothing is allocated otherwise.
+        options = {'enable_dynamic_variable_arrays': False}
+        lctx = (
+            LanguageContextBuilder()
+                .set_target_language("c")
+                .set_target_language_configuration_override(Language.WKCV_LANGUAGE_OPTIONS, options)
+                .create()
+        )
+        jinja_filter_tester(is_dynamically_allocated,
+                            template,
+                            'False False False',
+                            lctx, u8=u8, fixed=fixed, variable=variable)
+
+    """
+    if not language.get_option("enable_dynamic_variable_arrays"):
+        return False
+
+    def _contains_variable_length_array(data_type: pydsdl.SerializableType) -> bool:
+        if isinstance(data_type, pydsdl.VariableLengthArrayType):
+            return True
+        if isinstance(data_type, pydsdl.ArrayType):
+            return _contains_variable_length_array(data_type.element_type)
+        if isinstance(data_type, pydsdl.CompositeType):
+            return any(_contains_variable_length_array(f.data_type) for f in data_type.fields)
+        return False
+
+    return _contains_variable_length_array(t)
+
+
+@template_language_test(__name__)
+def is_serializable(language: Language, t: pydsdl.CompositeType) -> bool:
+    """
+    If serialization logic is generated for the type. This is the case unless the ``serialization_directions`` language
+    option selects ``deserialize`` or ``none`` for it.
+
+    .. invisible-code-block: python
+
+        from nunavut.lang.c import is_serializable, is_deserializable
+        from unittest.mock import MagicMock
+
+        def make_type(full_name):
+            t = MagicMock()
+            t.full_name = full_name
+            t.version.major = 1
+            t.version.minor = 0
+            t.has_parent_service = False
+            t.fields_except_padding = []
+            return t
+
+        sent = make_type('uavcan.node.Heartbeat')
+        received = make_type('uavcan.node.ExecuteCommand.Request')
+
+    .. code-block:: python
+
+        # Given
+        options = {'serialization_directions': {'uavcan.*': 'deserialize', 'uavcan.node.Heartbeat.1.*': 'serialize'}}
+
+        # and
+        template = (
+            '{{ sent is serializable }} {{ sent is deserializable }} '
+            '{{ received is serializable }} {{ received is deserializable }}'
+        )
+
+        # then
+        rendered = 'True False False True'
+
+    .. invisible-code-block: python
+
+        lctx = (
+            LanguageContextBuilder()
+                .set_target_language("c")
+                .set_target_language_configuration_override(Language.WKCV_LANGUAGE_OPTIONS, options)
+                .create()
+        )
+        jinja_filter_tester([is_serializable, is_deserializable], template, rendered, lctx, sent=sent, received=received)
+
+    """
+    return language.is_serialization_direction_generated(t, "serialize")
+
+
+@template_language_test(__name__)
+def is_deserializable(language: Language, t: pydsdl.CompositeType) -> bool:
+    """
+    If deserialization logic is generated for the type. See :func:`is_serializable`.
+    """
+    return language.is_serialization_direction_generated(t, "deserialize")
+
+
+@template_language_test(__name__)
+def is_serialization_direction_in_use(language: Language, direction: str) -> bool:
+    """
+    If the ``serialization_directions`` language option lets any type use the given direction (``serialize`` or
+    ``deserialize``). The support header leaves out the primitives for a direction no type can use. See
+    :meth:`nunavut.lang.Language.is_serialization_direction_in_use`.
+
+    .. invisible-code-block: python
+
+        from nunavut.lang.c import is_serialization_direction_in_use
+
+    .. code-block:: python
+
+        # Given
+        options = {'serialization_directions': {'*': 'deserialize'}}
+
+        # and
+        template = (
+            "{{ 'serialize' is serialization_direction_in_use }} "
+            "{{ 'deserialize' is serialization_direction_in_use }}"
+        )
+
+        # then
+        rendered = 'False True'
+
+    .. invisible-code-block: python
+
+        lctx = (
+            LanguageContextBuilder()
+                .set_target_language("c")
+                .set_target_language_configuration_override(Language.WKCV_LANGUAGE_OPTIONS, options)
+                .create()
+        )
+        jinja_filter_tester(is_serialization_direction_in_use, template, rendered, lctx)
+
+    """
+    return language.is_serialization_direction_in_use(direction)
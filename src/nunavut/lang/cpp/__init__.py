@@ -30,7 +30,7 @@ from nunavut._utilities import YesNoDefault, cached_property
 from nunavut.jinja.environment import Environment
 from nunavut.lang._common import IncludeGenerator, TokenEncoder, UniqueNameGenerator
 from nunavut.lang._language import Language as BaseLanguage
-from nunavut.lang.c import _CFit
+from nunavut.lang.c import EndiannessVariants, _CFit
 from nunavut.lang.c import filter_literal as c_filter_literal
 
 # +-------------------------------------------------------------------------------------------------------------------+
@@ -185,6 +185,10 @@ class Language(BaseLanguage):
     def _validate_globals(self, globals_map: typing.Dict[str, typing.Any]) -> typing.Dict[str, typing.Any]:
         globals_map["ConstructorConvention"] = ConstructorConvention
         globals_map["SpecialMethod"] = SpecialMethod
+        # In 'auto' mode the byte order is selected by a branch on a constant so that std::endian can be used.
+        globals_map["endianness_variants"] = EndiannessVariants(
+            str(self.get_option("target_endianness", "any")), selector="TargetIsLittleEndian"
+        )
         return globals_map
 
     @staticmethod
@@ -500,6 +504,22 @@ def uses_pmr(language: Language) -> bool:
     return language.standard_flavor == "pmr"
 
 
+@template_language_test(__name__)
+def is_serializable(language: Language, t: pydsdl.CompositeType) -> bool:
+    """
+    If ``serialize()`` is generated for the type. See :meth:`nunavut.lang.Language.get_serialization_direction`.
+    """
+    return language.is_serialization_direction_generated(t, "serialize")
+
+
+@template_language_test(__name__)
+def is_deserializable(language: Language, t: pydsdl.CompositeType) -> bool:
+    """
+    If ``deserialize()`` is generated for the type. See :meth:`nunavut.lang.Language.get_serialization_direction`.
+    """
+    return language.is_serialization_direction_generated(t, "deserialize")
+
+
 @template_language_filter(__name__)
 def filter_constant_value(language: Language, constant: pydsdl.Constant) -> str:
     """
@@ -1239,6 +1259,64 @@ def filter_value_initializer(language: Language, instance: pydsdl.Any, special_m
     return value_initializer
 
 
+@template_language_filter(__name__)
+def filter_allocator_args(language: Language, instance: pydsdl.Any, allocator: str, args: str = "") -> str:
+    """
+    Emit the argument list needed to construct the given field's value in-place using the given allocator
+    expression. This is used to construct union alternatives which cannot be initialized by a member-initializer.
+    If ``args`` is empty the value is constructed as it would be by the allocator constructor of the enclosing type.
+    Otherwise ``args`` are forwarded alongside the allocator following the configured constructor convention.
+    """
+    if not needs_allocator(instance):
+        return args
+
+    leading_args: typing.List[str] = []
+    trailing_args: typing.List[str] = []
+    if args:
+        trailing_args.append(args)
+    elif needs_vla_init_args(instance, SpecialMethod.ALLOCATOR_CONSTRUCTOR):
+        constructor_args = language.get_option("variable_array_type_constructor_args")
+        if isinstance(constructor_args, str) and len(constructor_args) > 0:
+            trailing_args.append(constructor_args.format(MAX_SIZE=instance.data_type.capacity))
+
+    if language.get_option("ctor_convention") == ConstructorConvention.USES_LEADING_ALLOCATOR.value:
+        leading_args.extend(["std::allocator_arg", allocator])
+    else:
+        trailing_args.append(allocator)
+
+    return ", ".join(leading_args + trailing_args)
+
+
+@template_language_filter(__name__)
+def filter_nothrow_move_condition(language: Language, composite: pydsdl.CompositeType, assignable: bool = False) -> str:
+    """
+    Emit a constant expression that is true if all fields of the given composite type can be move-constructed
+    (and, if ``assignable`` is true, also move-assigned) without throwing. Fields of primitive types are omitted
+    since moving them never throws. The expression refers to the field types through ``_traits_::TypeOf`` so it is
+    valid anywhere within the generated type.
+
+    Move-assigning an allocator-aware union constructs the alternative with the allocator of the destination. If the
+    two allocators differ this copies, and may allocate, so with ``assignable`` the expression is then also only true
+    for allocators that always compare equal.
+    """
+    traits = ["is_nothrow_move_constructible"]
+    if assignable:
+        traits.append("is_nothrow_move_assignable")
+    terms = [
+        f"std::{trait}<_traits_::TypeOf::{language.filter_id(field)}>::value"
+        for field in composite.fields_except_padding
+        if not isinstance(field.data_type, pydsdl.PrimitiveType)
+        for trait in traits
+    ]
+    if (
+        assignable
+        and isinstance(composite.inner_type, pydsdl.UnionType)
+        and language.get_option("ctor_convention") != ConstructorConvention.DEFAULT.value
+    ):
+        terms.append("std::allocator_traits<allocator_type>::is_always_equal::value")
+    return " && ".join(terms) if terms else "true"
+
+
 @template_language_filter(__name__)
 def filter_default_construction(language: Language, instance: pydsdl.Any, reference: str) -> str:
     """
@@ -379,6 +379,63 @@ def filter_numpy_scalar_type(t: pydsdl.Any) -> str:
     return "_np_.object_"
 
 
+@template_language_filter(__name__)
+def filter_numpy_structured_dtype(language: Language, t: pydsdl.CompositeType) -> str:
+    """
+    Returns a Python expression constructing a :class:`numpy.dtype` whose memory layout matches the serialized
+    representation of the given type byte-for-byte, or ``None`` if the type does not have such a fixed layout.
+
+    A type has a fixed layout if it is a structure of a fixed size where every field other than padding is
+    byte-aligned and is either an integer or a float of a standard bit length, a fixed-length array thereof, or a
+    non-delimited composite that has a fixed layout itself. Booleans, variable-length arrays, unions, and delimited
+    composites are not representable, and neither are structures without fields (their representation is empty or
+    padding only, which NumPy cannot view as an array of items). Nested composites refer to the ``_NUMPY_DTYPE_`` of
+    their generated class. Field names are the original unstropped names from the DSDL definition.
+    """
+    layout = _numpy_structured_layout(language, t)
+    if layout is None:
+        return "None"
+    names = ", ".join(repr(name) for name, _, _ in layout)
+    formats = ", ".join(fmt for _, fmt, _ in layout)
+    offsets = ", ".join(str(offset) for _, _, offset in layout)
+    return (
+        f"_np_.dtype({{'names': [{names}], 'formats': [{formats}], "
+        f"'offsets': [{offsets}], 'itemsize': {t.inner_type.bit_length_set.max // 8}}})"
+    )
+
+
+def _numpy_structured_layout(language: Language, t: pydsdl.CompositeType) -> list[tuple[str, str, int]] | None:
+    inner = t.inner_type
+    if not isinstance(inner, pydsdl.StructureType):
+        return None
+    bls = inner.bit_length_set
+    if bls.min != bls.max or bls.max % 8 != 0:
+        return None
+    layout = []
+    for f, offset in inner.iterate_fields_with_offsets():
+        if isinstance(f, pydsdl.PaddingField):
+            continue
+        fmt = _numpy_structured_format(language, f.data_type)
+        if fmt is None or not offset.is_aligned_at_byte():
+            return None
+        layout.append((f.name, fmt, offset.min // 8))
+    return layout or None
+
+
+def _numpy_structured_format(language: Language, t: pydsdl.SerializableType) -> str | None:
+    if isinstance(t, (pydsdl.IntegerType, pydsdl.FloatType)) and t.bit_length in (8, 16, 32, 64):
+        kind = "f" if isinstance(t, pydsdl.FloatType) else ("i" if isinstance(t, pydsdl.SignedIntegerType) else "u")
+        return repr(f"<{kind}{t.bit_length // 8}")
+    if isinstance(t, pydsdl.FixedLengthArrayType):
+        element = _numpy_structured_format(language, t.element_type)
+        return None if element is None else f"({element}, ({t.capacity},))"
+    if isinstance(t, pydsdl.CompositeType) and not isinstance(t, pydsdl.DelimitedType):
+        if _numpy_structured_layout(language, t) is None:
+            return None
+        return f"{filter_full_reference_name(language, t)}._NUMPY_DTYPE_"
+    return None
+
+
 def filter_newest_minor_version_aliases(tys: Iterable[pydsdl.CompositeType]) -> list[tuple[str, pydsdl.CompositeType]]:
     """
     Implementation of https://github.com/OpenCyphal/nunavut/issues/193
@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+# Copyright Amazon.com Inc. or its affiliates.
+# SPDX-License-Identifier: MIT
+#
+"""
+Benchmarks Nunavut code generation over synthetic DSDL corpora of increasing size. For each corpus size and target
+language this reports wall-clock time and peak traced Python memory for each phase of the same pipeline
+:func:`nunavut.generate_types` runs:
+
+- ``parse``  : pydsdl.read_namespace
+- ``tree``   : nunavut.build_namespace_tree
+- ``render`` : generating all types (and support) with no post-processors
+- ``pp``     : the additional cost of rendering with the nnvg line post-processors enabled
+
+Memory is measured in a separate pass from timing since tracemalloc slows allocation-heavy code considerably.
+
+Example::
+
+    python test/gentest_benchmark/bench_generation.py --sizes 100 400 1600 --languages c cpp py
+"""
+
+import argparse
+import dataclasses
+import json
+import pathlib
+import sys
+import tempfile
+import time
+import tracemalloc
+import typing
+
+import pydsdl
+
+from nunavut import build_namespace_tree
+from nunavut._generators import create_default_generators
+from nunavut._postprocessors import LimitEmptyLines, TrimTrailingWhitespace
+from nunavut.lang import LanguageContextBuilder
+
+sys.path.insert(0, str(pathlib.Path(__file__).parent))
+
+from synthetic_dsdl import CorpusParameters, generate_corpus  # noqa: E402 pylint: disable=wrong-import-position
+
+PHASES = ("parse", "tree", "render", "pp")
+
+
+@dataclasses.dataclass
+class PhaseResult:
+    """
+    Time and memory used by one phase.
+    """
+
+    seconds: float = 0.0
+    peak_bytes: int = 0
+
+
+class _Phase:
+    """
+    Context manager that times a phase or traces its peak memory.
+    """
+
+    def __init__(self, result: PhaseResult, trace_memory: bool):
+        self._result = result
+        self._trace_memory = trace_memory
+        self._start = 0.0
+
+    def __enter__(self) -> "_Phase":
+        if self._trace_memory:
+            tracemalloc.start()
+        else:
+            self._start = time.perf_counter()
+        return self
+
+    def __exit__(self, *_: typing.Any) -> None:
+        if self._trace_memory:
+            self._result.peak_bytes = tracemalloc.get_traced_memory()[1]
+            tracemalloc.stop()
+        else:
+            self._result.seconds = time.perf_counter() - self._start
+
+
+def _run_pipeline(
+    language: str, root_namespace: pathlib.Path, out_dir: pathlib.Path, trace_memory: bool
+) -> typing.Dict[str, PhaseResult]:
+    results = {phase: PhaseResult() for phase in PHASES}
+    language_context = (
+        LanguageContextBuilder(include_experimental_languages=True).set_target_language(language).create()
+    )
+
+    with _Phase(results["parse"], trace_memory):
+        type_map = pydsdl.read_namespace(str(root_namespace), [])
+
+    with _Phase(results["tree"], trace_memory):
+        namespace = build_namespace_tree(type_map, str(root_namespace), str(out_dir), language_context)
+
+    rendered = PhaseResult()
+    with _Phase(rendered, trace_memory):
+        generator, support_generator = create_default_generators(namespace)
+        support_generator.generate_all()
+        generator.generate_all()
+    results["render"] = rendered
+
+    with_pp = PhaseResult()
+    with _Phase(with_pp, trace_memory):
+        generator, support_generator = create_default_generators(
+            namespace, post_processors=[TrimTrailingWhitespace(), LimitEmptyLines(1)]
+        )
+        support_generator.generate_all()
+        generator.generate_all()
+    results["pp"] = PhaseResult(
+        max(0.0, with_pp.seconds - rendered.seconds), max(0, with_pp.peak_bytes - rendered.peak_bytes)
+    )
+    return results
+
+
+def run_benchmark(
+    sizes: typing.Iterable[int], languages: typing.Iterable[str], params: CorpusParameters, work_dir: pathlib.Path
+) -> typing.List[typing.Dict[str, typing.Any]]:
+    """
+    Generate a corpus for each size and run every language over it.
+
+    :return: One record per (size, language) with per-phase seconds and peak bytes.
+    """
+    records = []
+    for size in sizes:
+        corpus_dir = work_dir / f"corpus_{size}"
+        root_namespace = generate_corpus(dataclasses.replace(params, types=size), corpus_dir)
+        for language in languages:
+            timing = _run_pipeline(language, root_namespace, work_dir / f"out_{size}_{language}_t", False)
+            memory = _run_pipeline(language, root_namespace, work_dir / f"out_{size}_{language}_m", True)
+            records.append(
+                {
+                    "types": size,
+                    "language": language,
+                    "seconds": {phase: timing[phase].seconds for phase in PHASES},
+                    "peak_bytes": {phase: memory[phase].peak_bytes for phase in PHASES},
+                }
+            )
+    return records
+
+
+def _print_table(records: typing.List[typing.Dict[str, typing.Any]]) -> None:
+    header = f"{'types':>7} {'lang':>5} " + " ".join(f"{p + ' s':>9} {p + ' MiB':>10}" for p in PHASES)
+    print(header)
+    for record in records:
+        print(
+            f"{record['types']:>7} {record['language']:>5} "
+            + " ".join(
+                f"{record['seconds'][p]:>9.3f} {record['peak_bytes'][p] / (1024 * 1024):>10.1f}" for p in PHASES
+            )
+        )
+
+
+def main() -> int:
+    """
+    Command-line entry point.
+    """
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--sizes", type=int, nargs="+", default=[50, 200, 800], help="Corpus sizes (type counts).")
+    parser.add_argument("--languages", nargs="+", default=["c", "cpp", "py"], help="Target languages.")
+    parser.add_argument("--fields-per-type", type=int, default=CorpusParameters.fields_per_type)
+    parser.add_argument("--max-depth", type=int, default=CorpusParameters.max_depth)
+    parser.add_argument("--fan-out", type=int, default=CorpusParameters.fan_out)
+    parser.add_argument("--seed", type=int, default=CorpusParameters.seed)
+    parser.add_argument("--json", type=pathlib.Path, help="Also write the results to this file as JSON.")
+    parser.add_argument("--work-dir", type=pathlib.Path, help="Keep corpora and outputs here instead of a temp dir.")
+    args = parser.parse_args()
+
+    params = CorpusParameters(
+        fields_per_type=args.fields_per_type, max_depth=args.max_depth, fan_out=args.fan_out, seed=args.seed
+    )
+
+    if args.work_dir is not None:
+        args.work_dir.mkdir(parents=True, exist_ok=True)
+        records = run_benchmark(args.sizes, args.languages, params, args.work_dir)
+    else:
+        with tempfile.TemporaryDirectory() as work_dir:
+            records = run_benchmark(args.sizes, args.languages, params, pathlib.Path(work_dir))
+
+    _print_table(records)
+    if args.json is not None:
+        args.json.write_text(json.dumps(records, indent=2), encoding="utf-8")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
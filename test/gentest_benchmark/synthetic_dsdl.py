@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+# Copyright Amazon.com Inc. or its affiliates.
+# SPDX-License-Identifier: MIT
+#
+"""
+Generates synthetic DSDL corpora for benchmarking Nunavut. The output is a single root namespace with a configurable
+number of nested namespaces, types, fields, unions, arrays, and cross-namespace dependencies. Generation is
+deterministic for a given set of parameters (including the seed).
+
+Dependencies only ever point at types created earlier so the corpus is always acyclic, and a type's nesting depth
+(the longest chain of composite fields beneath it) is capped by ``max_depth`` to keep serialized sizes bounded.
+"""
+
+import argparse
+import dataclasses
+import pathlib
+import random
+import sys
+import typing
+
+_PRIMITIVES = ["bool", "uint8", "int16", "uint32", "int64", "float32", "float64", "saturated uint7"]
+
+
+@dataclasses.dataclass
+class CorpusParameters:
+    """
+    Shape of a synthetic corpus.
+    """
+
+    types: int = 100
+    """Total number of composite types to generate."""
+
+    namespaces: int = 8
+    """Number of namespaces under the root namespace to spread the types across."""
+
+    namespace_depth: int = 2
+    """How deeply each namespace is nested below the root namespace."""
+
+    max_depth: int = 3
+    """Maximum composite nesting depth of any type (0 means no composite fields at all)."""
+
+    fields_per_type: int = 6
+    """Number of fields in each type. Unions always have at least two."""
+
+    union_density: float = 0.2
+    """Fraction of types that are tagged unions."""
+
+    array_density: float = 0.3
+    """Fraction of fields that are arrays (fixed or variable length)."""
+
+    fan_out: int = 2
+    """Number of fields in each type that refer to a type in another namespace, where one is available."""
+
+    seed: int = 0
+    """Seed for the pseudo-random choices made while generating the corpus."""
+
+    root_namespace: str = "synth"
+    """Name of the root namespace."""
+
+
+@dataclasses.dataclass
+class _SyntheticType:
+    namespace: typing.List[str]
+    name: str
+    depth: int
+
+
+def _array_of(rng: random.Random, element: str) -> str:
+    if rng.random() < 0.5:
+        return f"{element}[{rng.randint(2, 8)}]"
+    return f"{element}[<={rng.randint(2, 16)}]"
+
+
+def generate_corpus(params: CorpusParameters, out_dir: pathlib.Path) -> pathlib.Path:
+    """
+    Write a synthetic corpus to disk.
+
+    :param params: The shape of the corpus.
+    :param out_dir: The directory to create the root namespace folder under.
+    :return: The path to the root namespace folder.
+    """
+    rng = random.Random(params.seed)
+    root_dir = out_dir / params.root_namespace
+
+    namespaces = [
+        [params.root_namespace] + [f"ns{n}_{level}" for level in range(params.namespace_depth)]
+        for n in range(max(1, params.namespaces))
+    ]
+    created = []  # type: typing.List[_SyntheticType]
+
+    for index in range(params.types):
+        namespace = namespaces[index % len(namespaces)]
+        is_union = rng.random() < params.union_density
+        field_count = max(2, params.fields_per_type) if is_union else max(0, params.fields_per_type)
+
+        candidates = [t for t in created if t.namespace != namespace and t.depth < params.max_depth]
+        fields = []  # type: typing.List[str]
+        depth = 0
+        for field_index in range(field_count):
+            if field_index < params.fan_out and len(candidates) > 0:
+                dependency = rng.choice(candidates)
+                depth = max(depth, dependency.depth + 1)
+                field_type = ".".join(dependency.namespace + [dependency.name]) + ".1.0"
+            else:
+                field_type = rng.choice(_PRIMITIVES)
+            if rng.random() < params.array_density:
+                field_type = _array_of(rng, field_type)
+            fields.append(f"{field_type} f{field_index}")
+
+        synthetic_type = _SyntheticType(namespace, f"Type{index}", depth)
+        created.append(synthetic_type)
+
+        lines = []  # type: typing.List[str]
+        if is_union:
+            lines.append("@union")
+        lines.extend(fields)
+        lines.append("@sealed")
+
+        type_dir = out_dir.joinpath(*namespace)
+        type_dir.mkdir(parents=True, exist_ok=True)
+        (type_dir / f"{synthetic_type.name}.1.0.dsdl").write_text("\n".join(lines) + "\n", encoding="utf-8")
+
+    return root_dir
+
+
+def _make_parser() -> argparse.ArgumentParser:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("out_dir", type=pathlib.Path, help="Directory to write the corpus under.")
+    defaults = CorpusParameters()
+    for field in dataclasses.fields(CorpusParameters):
+        parser.add_argument(
+            f"--{field.name.replace('_', '-')}",
+            type=type(getattr(defaults, field.name)),
+            default=getattr(defaults, field.name),
+            help=f"(default: {getattr(defaults, field.name)})",
+        )
+    return parser
+
+
+def main() -> int:
+    """
+    Command-line entry point.
+    """
+    args = vars(_make_parser().parse_args())
+    out_dir = args.pop("out_dir")
+    root = generate_corpus(CorpusParameters(**args), out_dir)
+    print(root)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,43 @@
+#
+# Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+# Copyright Amazon.com Inc. or its affiliates.
+# SPDX-License-Identifier: MIT
+#
+"""
+Keeps the synthetic corpus generator and the generation benchmark working. These don't measure anything; they only
+verify the tools produce valid DSDL and that the benchmark pipeline runs end-to-end.
+"""
+import typing
+
+import pydsdl
+import pytest
+from bench_generation import PHASES, run_benchmark
+from synthetic_dsdl import CorpusParameters, generate_corpus
+
+
+def test_synthetic_corpus_is_valid(gen_paths: typing.Any) -> None:
+    """
+    Verifies that a corpus using every feature of the generator parses and is deterministic.
+    """
+    params = CorpusParameters(types=40, namespaces=4, union_density=0.5, array_density=0.5, fan_out=3, seed=7)
+    root_namespace = generate_corpus(params, gen_paths.out_dir / "a")
+    type_map = pydsdl.read_namespace(str(root_namespace), [])
+    assert len(type_map) == 40
+    assert any(isinstance(t, pydsdl.UnionType) for t in type_map)
+
+    again = generate_corpus(params, gen_paths.out_dir / "b")
+    for dsdl_file in root_namespace.rglob("*.dsdl"):
+        assert dsdl_file.read_text() == (again / dsdl_file.relative_to(root_namespace)).read_text()
+
+
+@pytest.mark.parametrize("language", ["c", "cpp", "py"])
+def test_generation_benchmark_runs(gen_paths: typing.Any, language: str) -> None:
+    """
+    Runs the benchmark over a tiny corpus.
+    """
+    records = run_benchmark([10], [language], CorpusParameters(), gen_paths.out_dir)
+    assert len(records) == 1
+    assert records[0]["types"] == 10
+    for phase in PHASES:
+        assert records[0]["seconds"][phase] >= 0
+        assert records[0]["peak_bytes"][phase] >= 0
@@ -12,6 +12,7 @@ from pydsdl import read_namespace
 from nunavut import build_namespace_tree, Namespace
 from nunavut.lang import LanguageContextBuilder
 from nunavut.jinja import DSDLCodeGenerator
+from nunavut.jinja.loaders import DSDLTemplateLoader
 from nunavut._utilities import TEMPLATE_SUFFIX
 
 
@@ -47,6 +48,30 @@ def test_bfs_of_type_for_template(gen_paths):  # type: ignore
     assert generator.filter_type_to_template(subject) == template_file
 
 
+def test_type_to_template_is_cached(gen_paths):  # type: ignore
+    """ Verifies that the template lookup lists the templates once per loader and caches results, including misses,
+    per type.
+    """
+    loader = DSDLTemplateLoader(templates_dirs=[gen_paths.templates_dir])
+    list_templates_calls = []
+    original_list_templates = loader._fsloader.list_templates
+
+    def counting_list_templates():  # type: ignore
+        list_templates_calls.append(None)
+        return original_list_templates()
+
+    loader._fsloader.list_templates = counting_list_templates
+
+    template_d = loader.type_to_template(d)
+    assert template_d is not None
+    assert template_d.name == str(Path('c').with_suffix(TEMPLATE_SUFFIX))
+    assert loader.type_to_template(d) == template_d
+    assert loader.type_to_template(b).name == str(Path('a').with_suffix(TEMPLATE_SUFFIX))
+    assert loader.type_to_template(int) is None
+    assert loader.type_to_template(int) is None
+    assert len(list_templates_calls) == 1
+
+
 def test_one_template(gen_paths):  # type: ignore
     """ Verifies that we can use only a SeralizableType.j2 as the only template when
     no service types are present.
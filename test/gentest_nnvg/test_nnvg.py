@@ -144,6 +144,154 @@ def test_list_inputs_w_namespaces(gen_paths: typing.Any, run_nnvg: typing.Callab
     assert expected_output == sorted(completed_wo_empty)
 
 
+@pytest.mark.parametrize("jobs", ["0", "1"])
+def test_list_inputs_with_lookup_dirs(gen_paths: typing.Any, run_nnvg: typing.Callable, jobs: str) -> None:
+    """
+    Verifies that lookup namespaces, parsed serially or in worker processes, are not listed as inputs.
+    """
+    expected_output = sorted(
+        [
+            gen_paths.templates_dir / pathlib.Path("Any.j2"),
+            gen_paths.dsdl_dir / pathlib.Path("uavcan") / pathlib.Path("test") / pathlib.Path("TestType.0.8.dsdl"),
+        ]
+    )
+
+    nnvg_args = [
+        "--templates",
+        gen_paths.templates_dir.as_posix(),
+        "-O",
+        gen_paths.out_dir.as_posix(),
+        "-l",
+        "js",
+        "-Xlang",
+        "--omit-serialization-support",
+        "--list-inputs",
+        f"--jobs={jobs}",
+        "-I",
+        (gen_paths.dsdl_dir / pathlib.Path("scotec")).as_posix(),
+        "-I",
+        (gen_paths.dsdl_dir / pathlib.Path("herringtec")).as_posix(),
+        (gen_paths.dsdl_dir / pathlib.Path("uavcan")).as_posix(),
+    ]
+
+    completed = run_nnvg(gen_paths, nnvg_args).stdout.decode("utf-8").split(";")
+    completed_wo_empty = sorted([pathlib.Path(i) for i in completed if len(i) > 0])
+    assert expected_output == completed_wo_empty
+
+
+def test_jobs_output_matches_serial(gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
+    """
+    Verifies that parsing the lookup namespaces in worker processes generates the same files, with the same
+    contents, as parsing them serially, including where one lookup namespace depends on another.
+    """
+    dsdl_dir = gen_paths.out_dir / pathlib.Path("dsdl")
+    (dsdl_dir / "roota" / "sub").mkdir(parents=True, exist_ok=True)
+    (dsdl_dir / "rootb").mkdir(parents=True, exist_ok=True)
+    (dsdl_dir / "rootc").mkdir(parents=True, exist_ok=True)
+    (dsdl_dir / "roota" / "A.1.0.dsdl").write_text("uint8 a\n@sealed\n")
+    (dsdl_dir / "roota" / "sub" / "S.1.0.dsdl").write_text("roota.A.1.0[<=4] items\n@sealed\n")
+    (dsdl_dir / "rootb" / "B.1.0.dsdl").write_text("roota.sub.S.1.0 s\nrootc.C.1.0 c\n@sealed\n")
+    (dsdl_dir / "rootc" / "C.1.0.dsdl").write_text("float32 c\n@sealed\n")
+
+    templates = gen_paths.out_dir / pathlib.Path("templates")
+    templates.mkdir(parents=True, exist_ok=True)
+    (templates / "Any.j2").write_text("{{ T }}: {{ T.bit_length_set.max }}\n")
+
+    def _generate(jobs: str) -> typing.Dict[pathlib.Path, str]:
+        outdir = gen_paths.out_dir / pathlib.Path(f"out_jobs_{jobs}")
+        nnvg_args = [
+            "--templates",
+            templates.as_posix(),
+            "-O",
+            outdir.as_posix(),
+            "-l",
+            "js",
+            "-Xlang",
+            f"--jobs={jobs}",
+            "-I",
+            (dsdl_dir / "roota").as_posix(),
+            "-I",
+            (dsdl_dir / "rootc").as_posix(),
+            (dsdl_dir / "rootb").as_posix(),
+        ]
+        run_nnvg(gen_paths, nnvg_args)
+        return {p.relative_to(outdir): p.read_text() for p in outdir.rglob("*") if p.is_file()}
+
+    serial = _generate("1")
+    assert len(serial) == 1
+    assert serial == _generate("3")
+
+
+def test_watch_rejects_list_modes(gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
+    """
+    Verifies nnvg refuses to combine --watch with modes that must not write files.
+    """
+    nnvg_args = [
+        "--templates",
+        gen_paths.templates_dir.as_posix(),
+        "-O",
+        gen_paths.out_dir.as_posix(),
+        "-l",
+        "js",
+        "-Xlang",
+        "--watch",
+        "--list-inputs",
+        (gen_paths.dsdl_dir / pathlib.Path("scotec")).as_posix(),
+    ]
+
+    with pytest.raises(subprocess.CalledProcessError):
+        run_nnvg(gen_paths, nnvg_args, raise_called_process_error=True)
+
+
+def test_watch_regenerates_only_affected_outputs(gen_paths: typing.Any) -> None:
+    """
+    Verifies that, in watch mode, editing a definition rewrites only the outputs of that type and of the types that
+    depend on it, and that deleting a definition removes its output.
+    """
+    from nunavut.cli import _make_parser  # pylint: disable=import-outside-toplevel
+    from nunavut.cli.runners import ArgparseWatchRunner  # pylint: disable=import-outside-toplevel
+
+    root = gen_paths.out_dir / pathlib.Path("dsdl") / pathlib.Path("watchtest")
+    root.mkdir(parents=True, exist_ok=True)
+    (root / "A.1.0.dsdl").write_text("uint8 a\n@sealed\n")
+    (root / "B.1.0.dsdl").write_text("watchtest.A.1.0 a\n@sealed\n")
+    (root / "C.1.0.dsdl").write_text("uint8 c\n@sealed\n")
+
+    templates = gen_paths.out_dir / pathlib.Path("templates")
+    templates.mkdir(parents=True, exist_ok=True)
+    (templates / "Any.j2").write_text("{{ T }}: {{ T.bit_length_set.max }}\n")
+
+    outdir = gen_paths.out_dir / pathlib.Path("out")
+    args = _make_parser().parse_args(
+        ["--templates", templates.as_posix(), "-O", outdir.as_posix(), "-l", "js", "-Xlang", root.as_posix()]
+    )
+
+    def _outputs() -> typing.Dict[str, typing.Tuple[str, int]]:
+        return {
+            p.name: (p.read_text(), p.stat().st_mtime_ns)
+            for p in outdir.rglob("*")
+            if p.is_file() and p.parent.name == "watchtest"
+        }
+
+    runner = ArgparseWatchRunner(args.root_namespace, args, [])
+    try:
+        runner.regenerate(None)
+        before = _outputs()
+        assert {name.split("_")[0] for name in before} == {"A", "B", "C"}
+
+        (root / "A.1.0.dsdl").write_text("uint16 a\n@sealed\n")
+        runner.regenerate({(root / "A.1.0.dsdl").resolve()})
+        after = _outputs()
+        changed = {name.split("_")[0] for name in set(before) | set(after) if before.get(name) != after.get(name)}
+        assert changed == {"A", "B"}
+
+        (root / "C.1.0.dsdl").unlink()
+        runner.regenerate({(root / "C.1.0.dsdl").resolve()})
+        assert _outputs() == {name: value for name, value in after.items() if not name.startswith("C_")}
+    finally:
+        runner.close()
+
+
 def test_list_outputs(gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
     """
     Verifies nnvg's --list-output mode.
@@ -321,7 +469,7 @@ def test_language_option_defaults(gen_paths: typing.Any, run_nnvg: typing.Callab
         assert not generated_results["enable_serialization_asserts"]
 
 
-@pytest.mark.parametrize("target_endianness_override", ["any", "big", "little"])
+@pytest.mark.parametrize("target_endianness_override", ["any", "big", "little", "auto"])
 def test_language_option_overrides(
     target_endianness_override: str, gen_paths: typing.Any, run_nnvg: typing.Callable
 ) -> None:
@@ -436,6 +584,277 @@ def test_language_option_generate_asserts(gen_paths: typing.Any, run_nnvg: typin
         assert generated_results["enable_serialization_asserts"]
 
 
+@pytest.mark.parametrize("assert_level", ["none", "api", "full"])
+def test_language_option_assert_level(assert_level: str, gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
+    """
+    Verifies that the --serialization-assert-level option is wired up in nnvg.
+    """
+
+    expected_output = (
+        gen_paths.out_dir / pathlib.Path("uavcan") / pathlib.Path("test") / pathlib.Path("TestType_0_8.hpp")
+    )
+
+    nnvg_args = [
+        "--templates",
+        gen_paths.templates_dir.as_posix(),
+        "-O",
+        gen_paths.out_dir.as_posix(),
+        "--target-language",
+        "cpp",
+        "--experimental-languages",
+        "-I",
+        (gen_paths.dsdl_dir / pathlib.Path("scotec")).as_posix(),
+        "--enable-serialization-asserts",
+        "--serialization-assert-level",
+        assert_level,
+        (gen_paths.dsdl_dir / pathlib.Path("uavcan")).as_posix(),
+    ]
+
+    run_nnvg(gen_paths, nnvg_args).stdout.decode("utf-8").split(";")
+    with open(expected_output, "r") as generated:
+        generated_results = json.load(generated)
+        assert generated_results["enable_serialization_asserts"]
+        assert assert_level == generated_results["serialization_assert_level"]
+
+
+def test_language_option_transport_adapters(gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
+    """
+    Verifies that the --enable-transport-adapters option is wired up in nnvg.
+    """
+
+    expected_output = gen_paths.out_dir / pathlib.Path("uavcan") / pathlib.Path("test") / pathlib.Path("TestType_0_8.h")
+
+    nnvg_args = [
+        "--templates",
+        gen_paths.templates_dir.as_posix(),
+        "-O",
+        gen_paths.out_dir.as_posix(),
+        "--target-language",
+        "c",
+        "-I",
+        (gen_paths.dsdl_dir / pathlib.Path("scotec")).as_posix(),
+        "--enable-transport-adapters",
+        (gen_paths.dsdl_dir / pathlib.Path("uavcan")).as_posix(),
+    ]
+
+    run_nnvg(gen_paths, nnvg_args).stdout.decode("utf-8").split(";")
+    with open(expected_output, "r") as generated:
+        generated_results = json.load(generated)
+        assert generated_results["enable_transport_adapters"]
+
+
+def test_language_option_trusted_deserialization(gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
+    """
+    Verifies that the --enable-trusted-deserialization option is wired up in nnvg.
+    """
+
+    expected_output = (
+        gen_paths.out_dir / pathlib.Path("uavcan") / pathlib.Path("test") / pathlib.Path("TestType_0_8.hpp")
+    )
+
+    nnvg_args = [
+        "--templates",
+        gen_paths.templates_dir.as_posix(),
+        "-O",
+        gen_paths.out_dir.as_posix(),
+        "--target-language",
+        "cpp",
+        "-I",
+        (gen_paths.dsdl_dir / pathlib.Path("scotec")).as_posix(),
+        "--enable-trusted-deserialization",
+        (gen_paths.dsdl_dir / pathlib.Path("uavcan")).as_posix(),
+    ]
+
+    run_nnvg(gen_paths, nnvg_args).stdout.decode("utf-8").split(";")
+    with open(expected_output, "r") as generated:
+        generated_results = json.load(generated)
+        assert generated_results["enable_trusted_deserialization"]
+
+
+def test_language_option_restrict_qualifiers(gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
+    """
+    Verifies that the --enable-restrict-qualifiers option is wired up in nnvg.
+    """
+
+    expected_output = gen_paths.out_dir / pathlib.Path("uavcan") / pathlib.Path("test") / pathlib.Path("TestType_0_8.h")
+
+    nnvg_args = [
+        "--templates",
+        gen_paths.templates_dir.as_posix(),
+        "-O",
+        gen_paths.out_dir.as_posix(),
+        "--target-language",
+        "c",
+        "-I",
+        (gen_paths.dsdl_dir / pathlib.Path("scotec")).as_posix(),
+        "--enable-restrict-qualifiers",
+        (gen_paths.dsdl_dir / pathlib.Path("uavcan")).as_posix(),
+    ]
+
+    run_nnvg(gen_paths, nnvg_args).stdout.decode("utf-8").split(";")
+    with open(expected_output, "r") as generated:
+        generated_results = json.load(generated)
+        assert generated_results["enable_restrict_qualifiers"]
+
+
+def test_language_option_dynamic_variable_arrays(gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
+    """
+    Verifies that the --enable-dynamic-variable-arrays option is wired up in nnvg.
+    """
+
+    expected_output = gen_paths.out_dir / pathlib.Path("uavcan") / pathlib.Path("test") / pathlib.Path("TestType_0_8.h")
+
+    nnvg_args = [
+        "--templates",
+        gen_paths.templates_dir.as_posix(),
+        "-O",
+        gen_paths.out_dir.as_posix(),
+        "--target-language",
+        "c",
+        "-I",
+        (gen_paths.dsdl_dir / pathlib.Path("scotec")).as_posix(),
+        "--enable-dynamic-variable-arrays",
+        (gen_paths.dsdl_dir / pathlib.Path("uavcan")).as_posix(),
+    ]
+
+    run_nnvg(gen_paths, nnvg_args).stdout.decode("utf-8").split(";")
+    with open(expected_output, "r") as generated:
+        generated_results = json.load(generated)
+        assert generated_results["enable_dynamic_variable_arrays"]
+
+
+@pytest.mark.parametrize("enable_slots", [True, False])
+def test_language_option_python_slots(enable_slots: bool, gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
+    """
+    Verifies that generated Python classes use __slots__ unless the enable_slots option is turned off.
+    """
+
+    expected_output = (
+        gen_paths.out_dir / pathlib.Path("uavcan") / pathlib.Path("test") / pathlib.Path("TestType_0_8.py")
+    )
+    config_file = gen_paths.out_dir / pathlib.Path("slots.yaml")
+    config_file.parent.mkdir(parents=True, exist_ok=True)
+    config_file.write_text(f"nunavut.lang.py:\n    options:\n        enable_slots: {str(enable_slots).lower()}\n")
+
+    nnvg_args = [
+        "-O",
+        gen_paths.out_dir.as_posix(),
+        "--target-language",
+        "py",
+        "-I",
+        (gen_paths.dsdl_dir / pathlib.Path("scotec")).as_posix(),
+        "--configuration",
+        config_file.as_posix(),
+        "--",
+        (gen_paths.dsdl_dir / pathlib.Path("uavcan")).as_posix(),
+    ]
+
+    run_nnvg(gen_paths, nnvg_args)
+    assert ("__slots__" in expected_output.read_text()) == enable_slots
+
+
+def test_language_option_serialization_directions(gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
+    """
+    Verifies that the --serialization-direction option is wired up in nnvg and applied after the configuration.
+    """
+
+    expected_output = gen_paths.out_dir / pathlib.Path("uavcan") / pathlib.Path("test") / pathlib.Path("TestType_0_8.h")
+
+    nnvg_args = [
+        "--templates",
+        gen_paths.templates_dir.as_posix(),
+        "-O",
+        gen_paths.out_dir.as_posix(),
+        "--target-language",
+        "c",
+        "-I",
+        (gen_paths.dsdl_dir / pathlib.Path("scotec")).as_posix(),
+        "--serialization-direction",
+        "uavcan.*=deserialize",
+        "--serialization-direction",
+        "uavcan.test.TestType.0.8=serialize",
+        (gen_paths.dsdl_dir / pathlib.Path("uavcan")).as_posix(),
+    ]
+
+    run_nnvg(gen_paths, nnvg_args).stdout.decode("utf-8").split(";")
+    with open(expected_output, "r") as generated:
+        generated_results = json.load(generated)
+        assert generated_results["serialization_directions"] == {
+            "uavcan.*": "deserialize",
+            "uavcan.test.TestType.0.8": "serialize",
+        }
+
+
+def test_language_option_serialization_directions_order(gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
+    """
+    Verifies that a pattern given again, on the command line or over a configuration file, moves to where it was given
+    last so that the last matching pattern still wins.
+    """
+
+    expected_output = gen_paths.out_dir / pathlib.Path("uavcan") / pathlib.Path("test") / pathlib.Path("TestType_0_8.h")
+    config_file = gen_paths.out_dir / pathlib.Path("directions.yaml")
+    config_file.parent.mkdir(parents=True, exist_ok=True)
+    config_file.write_text(
+        "nunavut.lang.c:\n"
+        "    options:\n"
+        "        serialization_directions:\n"
+        "            'uavcan.*': none\n"
+        "            'uavcan.test.*': serialize\n"
+    )
+
+    nnvg_args = [
+        "--templates",
+        gen_paths.templates_dir.as_posix(),
+        "-O",
+        gen_paths.out_dir.as_posix(),
+        "--target-language",
+        "c",
+        "-I",
+        (gen_paths.dsdl_dir / pathlib.Path("scotec")).as_posix(),
+        "--configuration",
+        config_file.as_posix(),
+        "--serialization-direction",
+        "uavcan.*=serialize",
+        "--serialization-direction",
+        "uavcan.test.TestType.0.8=none",
+        "--serialization-direction",
+        "uavcan.*=deserialize",
+        "--",
+        (gen_paths.dsdl_dir / pathlib.Path("uavcan")).as_posix(),
+    ]
+
+    run_nnvg(gen_paths, nnvg_args)
+    with open(expected_output, "r") as generated:
+        generated_results = json.load(generated)
+        assert list(generated_results["serialization_directions"].items()) == [
+            ("uavcan.test.*", "serialize"),
+            ("uavcan.test.TestType.0.8", "none"),
+            ("uavcan.*", "deserialize"),
+        ]
+
+
+@pytest.mark.parametrize("rule", ["uavcan.*", "uavcan.*=send"])
+def test_language_option_serialization_directions_illegal_option(
+    rule: str, gen_paths: typing.Any, run_nnvg: typing.Callable
+) -> None:
+    """
+    Verifies that malformed --serialization-direction rules are rejected.
+    """
+
+    nnvg_args = [
+        "-O",
+        gen_paths.out_dir.as_posix(),
+        "--target-language",
+        "c",
+        "--serialization-direction",
+        rule,
+        (gen_paths.dsdl_dir / pathlib.Path("uavcan")).as_posix(),
+    ]
+
+    with pytest.raises(subprocess.CalledProcessError):
+        run_nnvg(gen_paths, nnvg_args, raise_called_process_error=True)
+
+
 def test_generate_support_only(gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
     """
     Verifies expected language option defaults can be overridden.
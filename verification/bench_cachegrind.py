@@ -0,0 +1,160 @@
+#
+# Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+# Copyright Amazon.com Inc. or its affiliates.
+# SPDX-License-Identifier: MIT
+#
+"""
+Deterministic instruction and simulated-cache counts for the serialization benchmarks.
+
+Wall-clock time and hardware counters are too noisy on shared CI runners to compare two commits. This script runs each
+(type, operation) pair of a benchmark binary under ``valgrind --tool=cachegrind`` twice: once with ``--iterations``
+set to ``--baseline-iterations`` and once to ``--iterations``. Subtracting the two runs cancels process start-up,
+object initialization, and the warm-up call, leaving the exact cost of one serialize or deserialize call. The results
+are written as a sorted, fixed-width text report (or JSON) that can be checked in or diffed between commits::
+
+    python verification/bench_cachegrind.py build/suite/bench_serialization -o before.txt
+    # ...change something, rebuild...
+    python verification/bench_cachegrind.py build/suite/bench_serialization -o after.txt
+    diff before.txt after.txt
+"""
+
+import argparse
+import json
+import pathlib
+import shutil
+import subprocess
+import sys
+import tempfile
+import typing
+
+#: Cachegrind events included in the report, in column order. Ir, Dr, and Dw are always collected; the miss counts
+#: require --cache-sim=yes and reflect cachegrind's simulated cache, not the host's.
+EVENTS = ("Ir", "Dr", "Dw", "I1mr", "D1mr", "D1mw", "ILmr", "DLmr", "DLmw")
+
+OPERATIONS = ("ser", "deser")
+
+
+def parse_cachegrind_output(path: pathlib.Path) -> typing.Dict[str, int]:
+    """
+    Return the program-wide totals from a cachegrind output file, keyed by event name.
+    """
+    events: typing.List[str] = []
+    totals: typing.List[int] = []
+    with open(path, "r", encoding="utf-8") as cg_file:
+        for line in cg_file:
+            if line.startswith("events:"):
+                events = line.split()[1:]
+            elif line.startswith("summary:"):
+                totals = [int(value) for value in line.split()[1:]]
+    if not events or len(events) != len(totals):
+        raise ValueError(f"{path} is not a complete cachegrind output file.")
+    return dict(zip(events, totals))
+
+
+def list_types(binary: pathlib.Path) -> typing.List[str]:
+    """
+    Ask the benchmark binary which types it covers.
+    """
+    result = subprocess.run([str(binary), "--list"], check=True, capture_output=True, text=True)
+    return [line.strip() for line in result.stdout.splitlines() if line.strip()]
+
+
+def run_cachegrind(
+    valgrind: str, binary: pathlib.Path, type_name: str, op: str, iterations: int, out_file: pathlib.Path
+) -> typing.Dict[str, int]:
+    """
+    Run one operation of one type ``iterations`` times under cachegrind and return the event totals.
+    """
+    subprocess.run(
+        [
+            valgrind,
+            "--tool=cachegrind",
+            "--cache-sim=yes",
+            f"--cachegrind-out-file={out_file}",
+            str(binary),
+            "--type",
+            type_name,
+            "--op",
+            op,
+            "--iterations",
+            str(iterations),
+        ],
+        check=True,
+        stdout=subprocess.DEVNULL,
+        stderr=subprocess.DEVNULL,
+    )
+    return parse_cachegrind_output(out_file)
+
+
+def per_operation(
+    baseline: typing.Dict[str, int], measured: typing.Dict[str, int], iterations_delta: int
+) -> typing.Dict[str, int]:
+    """
+    Cost of one operation given two runs that differ only in their iteration count. Values are rounded to the nearest
+    integer; for straight-line serialization code the division is exact.
+    """
+    return {
+        event: (measured[event] - baseline[event] + iterations_delta // 2) // iterations_delta
+        for event in EVENTS
+        if event in measured and event in baseline
+    }
+
+
+def format_report(binary_name: str, rows: typing.List[typing.Dict[str, typing.Any]]) -> str:
+    """
+    Render the results as a fixed-width table sorted by type and operation so reports diff cleanly.
+    """
+    lines = [f"# cachegrind per-operation counts for {binary_name}"]
+    lines.append(f"{'type':<48} {'op':<6}" + "".join(f" {event:>12}" for event in EVENTS))
+    for row in sorted(rows, key=lambda r: (r["type"], OPERATIONS.index(r["op"]))):
+        counts = row["counts"]
+        lines.append(
+            f"{row['type']:<48} {row['op']:<6}" + "".join(f" {str(counts.get(event, '-')):>12}" for event in EVENTS)
+        )
+    return "\n".join(lines) + "\n"
+
+
+def main(args: typing.Optional[typing.List[str]] = None) -> int:
+    """
+    Command-line entry point.
+    """
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("binary", type=pathlib.Path, help="A benchmark binary (e.g. bench_serialization).")
+    parser.add_argument("-o", "--output", type=pathlib.Path, help="Write the report here instead of stdout.")
+    parser.add_argument("--json", action="store_true", help="Write JSON instead of a text table.")
+    parser.add_argument("--type", action="append", dest="types", help="Only measure this type (repeatable).")
+    parser.add_argument("--iterations", type=int, default=11, help="Iterations for the measured run.")
+    parser.add_argument("--baseline-iterations", type=int, default=1, help="Iterations for the baseline run.")
+    parser.add_argument("--valgrind", default="valgrind", help="The valgrind executable to use.")
+    parsed = parser.parse_args(args)
+
+    if parsed.iterations <= parsed.baseline_iterations or parsed.baseline_iterations < 1:
+        parser.error("--iterations must be greater than --baseline-iterations, which must be at least 1.")
+    valgrind = shutil.which(parsed.valgrind)
+    if valgrind is None:
+        parser.error(f"{parsed.valgrind} was not found.")
+
+    types = parsed.types or list_types(parsed.binary)
+    rows: typing.List[typing.Dict[str, typing.Any]] = []
+    with tempfile.TemporaryDirectory() as temp_dir:
+        out_file = pathlib.Path(temp_dir) / "cachegrind.out"
+        for type_name in types:
+            for op in OPERATIONS:
+                baseline = run_cachegrind(valgrind, parsed.binary, type_name, op, parsed.baseline_iterations, out_file)
+                measured = run_cachegrind(valgrind, parsed.binary, type_name, op, parsed.iterations, out_file)
+                counts = per_operation(baseline, measured, parsed.iterations - parsed.baseline_iterations)
+                rows.append({"type": type_name, "op": op, "counts": counts})
+
+    if parsed.json:
+        report = json.dumps(sorted(rows, key=lambda r: (r["type"], r["op"])), indent=2, sort_keys=True) + "\n"
+    else:
+        report = format_report(parsed.binary.name, rows)
+    if parsed.output is not None:
+        parsed.output.write_text(report, encoding="utf-8")
+    else:
+        sys.stdout.write(report)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
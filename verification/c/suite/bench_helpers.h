@@ -0,0 +1,262 @@
+// Copyright (c) 2024 OpenCyphal Development Team.
+// This software is distributed under the terms of the MIT License.
+//
+// Minimal, dependency-free helpers shared by the C and C++ serialization benchmarks. Timing uses the monotonic clock.
+// When requested, Linux hardware performance counters are collected through perf_event_open(2) for each benchmark;
+// every counter that cannot be opened (no kernel support, perf_event_paranoid, virtualized PMU, non-Linux host) is
+// reported as "-" instead of failing the benchmark.
+
+#ifndef NUNAVUT_VERIFICATION_BENCH_HELPERS_H_INCLUDED
+#define NUNAVUT_VERIFICATION_BENCH_HELPERS_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__linux__)
+#    include <linux/perf_event.h>
+#    include <sys/ioctl.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+typedef enum
+{
+    BenchCounterInstructions = 0,
+    BenchCounterCycles,
+    BenchCounterBranchMisses,
+    BenchCounterL1DMisses,
+    BenchCounterLLCMisses,
+    BenchCounterCount
+} BenchCounter;
+
+static const char* const BenchCounterNames[BenchCounterCount] = {"instr", "cycles", "br-miss", "l1d-miss", "llc-miss"};
+
+typedef struct
+{
+    int      fd[BenchCounterCount];
+    uint64_t value[BenchCounterCount];
+} BenchPerfCounters;
+
+#if defined(__linux__)
+static inline int benchPerfOpenOne(uint32_t type, uint64_t config)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size           = sizeof(attr);
+    attr.type           = type;
+    attr.config         = config;
+    attr.disabled       = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+    return (int) syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+#endif
+
+/// Open every counter that is available. Counters are opened individually, not as a group, so one missing event
+/// doesn't disable the others. With enable == false all counters are reported as unavailable.
+static inline void benchPerfOpen(BenchPerfCounters* const counters, const bool enable)
+{
+    for (size_t i = 0; i < BenchCounterCount; ++i)
+    {
+        counters->fd[i]    = -1;
+        counters->value[i] = 0;
+    }
+#if defined(__linux__)
+    if (enable)
+    {
+        const uint64_t l1d_read_miss = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8U) |
+                                       (PERF_COUNT_HW_CACHE_RESULT_MISS << 16U);
+        counters->fd[BenchCounterInstructions] = benchPerfOpenOne(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+        counters->fd[BenchCounterCycles]       = benchPerfOpenOne(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        counters->fd[BenchCounterBranchMisses] = benchPerfOpenOne(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+        counters->fd[BenchCounterL1DMisses]    = benchPerfOpenOne(PERF_TYPE_HW_CACHE, l1d_read_miss);
+        counters->fd[BenchCounterLLCMisses]    = benchPerfOpenOne(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    }
+#else
+    (void) enable;
+#endif
+}
+
+static inline void benchPerfClose(BenchPerfCounters* const counters)
+{
+#if defined(__linux__)
+    for (size_t i = 0; i < BenchCounterCount; ++i)
+    {
+        if (counters->fd[i] >= 0)
+        {
+            (void) close(counters->fd[i]);
+            counters->fd[i] = -1;
+        }
+    }
+#else
+    (void) counters;
+#endif
+}
+
+static inline void benchPerfStart(BenchPerfCounters* const counters)
+{
+#if defined(__linux__)
+    for (size_t i = 0; i < BenchCounterCount; ++i)
+    {
+        if (counters->fd[i] >= 0)
+        {
+            (void) ioctl(counters->fd[i], PERF_EVENT_IOC_RESET, 0);
+            (void) ioctl(counters->fd[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#else
+    (void) counters;
+#endif
+}
+
+static inline void benchPerfStop(BenchPerfCounters* const counters)
+{
+#if defined(__linux__)
+    for (size_t i = 0; i < BenchCounterCount; ++i)
+    {
+        if (counters->fd[i] >= 0)
+        {
+            (void) ioctl(counters->fd[i], PERF_EVENT_IOC_DISABLE, 0);
+            if (read(counters->fd[i], &counters->value[i], sizeof(counters->value[i])) !=
+                (ssize_t) sizeof(counters->value[i]))
+            {
+                counters->value[i] = 0;
+            }
+        }
+    }
+#else
+    (void) counters;
+#endif
+}
+
+static inline uint64_t benchNowNs(void)
+{
+    struct timespec ts;
+    (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec * 1000000000ULL) + (uint64_t) ts.tv_nsec;
+}
+
+/// Command-line options common to all benchmark binaries:
+///
+///     --perf                 collect hardware performance counters
+///     --list                 print the name of each benchmarked type and exit
+///     --type <name>          only run benchmarks for this type
+///     --op <ser|deser>       only run this operation
+///     --iterations <n>       run exactly n iterations instead of a size-based default
+///
+/// --type, --op and --iterations together let an external tool (see verification/bench_cachegrind.py) run a single
+/// operation a known number of times under an instruction-counting simulator.
+typedef struct
+{
+    bool        perf;
+    bool        list;
+    const char* type;
+    const char* op;
+    uint64_t    iterations;
+} BenchOptions;
+
+/// Returns false, after printing a message, if the arguments could not be parsed.
+static inline bool benchParseOptions(const int argc, char* const* const argv, BenchOptions* const out_options)
+{
+    memset(out_options, 0, sizeof(*out_options));
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool has_value = (i + 1) < argc;
+        if (strcmp(argv[i], "--perf") == 0)
+        {
+            out_options->perf = true;
+        }
+        else if (strcmp(argv[i], "--list") == 0)
+        {
+            out_options->list = true;
+        }
+        else if (has_value && (strcmp(argv[i], "--type") == 0))
+        {
+            out_options->type = argv[++i];
+        }
+        else if (has_value && (strcmp(argv[i], "--op") == 0))
+        {
+            out_options->op = argv[++i];
+        }
+        else if (has_value && (strcmp(argv[i], "--iterations") == 0))
+        {
+            out_options->iterations = (uint64_t) strtoull(argv[++i], NULL, 10);
+        }
+        else
+        {
+            fprintf(stderr, "Unknown or incomplete argument: %s\n", argv[i]);
+            return false;
+        }
+    }
+    return true;
+}
+
+/// True if the given type and operation (or NULL for any operation) were not filtered out by the options.
+static inline bool benchSelected(const BenchOptions* const options, const char* const type_name, const char* const op)
+{
+    if ((options->type != NULL) && (strcmp(options->type, type_name) != 0))
+    {
+        return false;
+    }
+    return (op == NULL) || (options->op == NULL) || (strcmp(options->op, op) == 0);
+}
+
+static inline void benchPrintHeader(void)
+{
+    printf("%-48s %-6s %10s %8s", "type", "op", "iterations", "ns/op");
+    for (size_t i = 0; i < BenchCounterCount; ++i)
+    {
+        printf(" %12s", BenchCounterNames[i]);
+    }
+    printf("\n");
+}
+
+/// Print one result row. Counter values are per operation.
+static inline void benchPrintResult(const char* const type_name,
+                                    const char* const op,
+                                    const uint64_t    iterations,
+                                    const uint64_t    elapsed_ns,
+                                    const BenchPerfCounters* const counters)
+{
+    printf("%-48s %-6s %10llu %8.1f",
+           type_name,
+           op,
+           (unsigned long long) iterations,
+           (double) elapsed_ns / (double) iterations);
+    for (size_t i = 0; i < BenchCounterCount; ++i)
+    {
+        if (counters->fd[i] >= 0)
+        {
+            printf(" %12.2f", (double) counters->value[i] / (double) iterations);
+        }
+        else
+        {
+            printf(" %12s", "-");
+        }
+    }
+    printf("\n");
+}
+
+/// Pick an iteration count that keeps each benchmark to roughly the same amount of work regardless of message size
+/// unless the options ask for a specific count.
+static inline uint64_t benchIterationsFor(const BenchOptions* const options, const size_t buffer_size_bytes)
+{
+    if (options->iterations > 0U)
+    {
+        return options->iterations;
+    }
+    const uint64_t budget_bytes = 64ULL * 1024ULL * 1024ULL;
+    const uint64_t size         = (buffer_size_bytes > 0U) ? (uint64_t) buffer_size_bytes : 1U;
+    const uint64_t iterations   = budget_bytes / size;
+    if (iterations < 4U)
+    {
+        return 4U;
+    }
+    return (iterations > 1000000U) ? 1000000U : iterations;
+}
+
+#endif  // NUNAVUT_VERIFICATION_BENCH_HELPERS_H_INCLUDED
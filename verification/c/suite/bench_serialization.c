@@ -0,0 +1,161 @@
+// Copyright (c) 2024 OpenCyphal Development Team.
+// This software is distributed under the terms of the MIT License.
+//
+// Serialization micro-benchmarks for generated C types. Not part of test_all; build and run with the
+// bench_serialization target (or run_bench_serialization). Pass --perf to collect hardware performance counters.
+
+#define _GNU_SOURCE  // syscall() and clock_gettime() are hidden by -std=c11 otherwise.
+
+#include <regulated/basics/Primitive_0_1.h>
+#include <regulated/basics/PrimitiveArrayFixed_0_1.h>
+#include <regulated/basics/PrimitiveArrayVariable_0_1.h>
+#include <regulated/basics/Struct__0_1.h>
+#include <regulated/basics/Union_0_1.h>
+#include <regulated/RGB888_3840x2748_0_1.h>
+#include <uavcan/node/Heartbeat_1_0.h>
+#include "bench_helpers.h"
+#include "round_trip_helpers.h"
+#include <stdlib.h>
+
+typedef int8_t (*BenchSerializeFn)(const void* obj, uint8_t* buffer, size_t* inout_size);
+typedef int8_t (*BenchDeserializeFn)(void* obj, const uint8_t* buffer, size_t* inout_size);
+
+#define BENCH_DEFINE_ADAPTERS(type_)                                                                       \
+    static int8_t benchSerialize_##type_(const void* obj, uint8_t* buffer, size_t* inout_size)          \
+    {                                                                                                      \
+        return type_##_serialize_((const type_*) obj, buffer, inout_size);                                 \
+    }                                                                                                      \
+    static int8_t benchDeserialize_##type_(void* obj, const uint8_t* buffer, size_t* inout_size)        \
+    {                                                                                                      \
+        return type_##_deserialize_((type_*) obj, buffer, inout_size);                                     \
+    }
+
+BENCH_DEFINE_ADAPTERS(regulated_basics_Primitive_0_1)
+BENCH_DEFINE_ADAPTERS(regulated_basics_PrimitiveArrayFixed_0_1)
+BENCH_DEFINE_ADAPTERS(regulated_basics_PrimitiveArrayVariable_0_1)
+BENCH_DEFINE_ADAPTERS(regulated_basics_Struct__0_1)
+BENCH_DEFINE_ADAPTERS(regulated_basics_Union_0_1)
+BENCH_DEFINE_ADAPTERS(regulated_RGB888_3840x2748_0_1)
+BENCH_DEFINE_ADAPTERS(uavcan_node_Heartbeat_1_0)
+
+/// Benchmark serialization then deserialization of one object. Returns false if either operation fails.
+static bool benchType(const char* const         type_name,
+                      void* const               obj,
+                      const size_t              buffer_size,
+                      const BenchSerializeFn    serialize,
+                      const BenchDeserializeFn  deserialize,
+                      const BenchOptions* const options)
+{
+    if (options->list)
+    {
+        printf("%s\n", type_name);
+        return true;
+    }
+    if (!benchSelected(options, type_name, NULL))
+    {
+        return true;
+    }
+    uint8_t* const buffer = (uint8_t*) malloc(buffer_size);
+    if (buffer == NULL)
+    {
+        fprintf(stderr, "%s: out of memory\n", type_name);
+        return false;
+    }
+    const uint64_t    iterations = benchIterationsFor(options, buffer_size);
+    BenchPerfCounters counters;
+    benchPerfOpen(&counters, options->perf);
+
+    size_t size   = buffer_size;
+    int8_t result = serialize(obj, buffer, &size);  // warm-up and input for deserialization
+    if ((result >= 0) && benchSelected(options, type_name, "ser"))
+    {
+        const uint64_t start = benchNowNs();
+        benchPerfStart(&counters);
+        for (uint64_t i = 0; (i < iterations) && (result >= 0); ++i)
+        {
+            size   = buffer_size;
+            result = serialize(obj, buffer, &size);
+        }
+        benchPerfStop(&counters);
+        const uint64_t elapsed = benchNowNs() - start;
+        if (result >= 0)
+        {
+            benchPrintResult(type_name, "ser", iterations, elapsed, &counters);
+        }
+    }
+    if (result < 0)
+    {
+        fprintf(stderr, "%s: serialization failed (%d)\n", type_name, (int) result);
+    }
+    else if (benchSelected(options, type_name, "deser"))
+    {
+        const size_t   serialized_size = size;
+        const uint64_t start           = benchNowNs();
+        benchPerfStart(&counters);
+        for (uint64_t i = 0; (i < iterations) && (result >= 0); ++i)
+        {
+            size   = serialized_size;
+            result = deserialize(obj, buffer, &size);
+        }
+        benchPerfStop(&counters);
+        const uint64_t elapsed = benchNowNs() - start;
+        if (result < 0)
+        {
+            fprintf(stderr, "%s: deserialization failed (%d)\n", type_name, (int) result);
+        }
+        else
+        {
+            benchPrintResult(type_name, "deser", iterations, elapsed, &counters);
+        }
+    }
+
+    benchPerfClose(&counters);
+    free(buffer);
+    return result >= 0;
+}
+
+/// Variable-length arrays are filled to capacity so every type is measured at its largest serialized size. The seed is
+/// fixed per type so results do not depend on which types are selected.
+#define BENCH_TYPE(type_, options_)                                                      \
+    do                                                                                   \
+    {                                                                                    \
+        type_* const obj_ = (type_*) calloc(1, sizeof(type_));                           \
+        ok                = (obj_ != NULL) && ok;                                        \
+        if (obj_ != NULL)                                                                \
+        {                                                                                \
+            uint64_t      state_ = 0x5EEDU;                                              \
+            NunavutRandom rng_   = {&splitMix64, &state_, NunavutRandomArrayLengthFull}; \
+            type_##_randomize_(obj_, &rng_);                                             \
+            ok = benchType(#type_,                                                       \
+                           obj_,                                                         \
+                           type_##_SERIALIZATION_BUFFER_SIZE_BYTES_,                     \
+                           &benchSerialize_##type_,                                      \
+                           &benchDeserialize_##type_,                                    \
+                           (options_)) &&                                                \
+                 ok;                                                                     \
+            free(obj_);                                                                  \
+        }                                                                                \
+    } while (false)
+
+int main(int argc, char* argv[])
+{
+    BenchOptions options;
+    if (!benchParseOptions(argc, argv, &options))
+    {
+        return 2;
+    }
+    bool ok = true;
+
+    if (!options.list)
+    {
+        benchPrintHeader();
+    }
+    BENCH_TYPE(regulated_basics_Primitive_0_1, &options);
+    BENCH_TYPE(regulated_basics_PrimitiveArrayFixed_0_1, &options);
+    BENCH_TYPE(regulated_basics_PrimitiveArrayVariable_0_1, &options);
+    BENCH_TYPE(regulated_basics_Struct__0_1, &options);
+    BENCH_TYPE(regulated_basics_Union_0_1, &options);
+    BENCH_TYPE(uavcan_node_Heartbeat_1_0, &options);
+    BENCH_TYPE(regulated_RGB888_3840x2748_0_1, &options);
+    return ok ? 0 : 1;
+}
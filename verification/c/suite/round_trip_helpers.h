@@ -0,0 +1,61 @@
+// Copyright (c) 2024 OpenCyphal Development Team.
+// This software is distributed under the terms of the MIT License.
+//
+// Helpers shared by the C tests that round-trip randomized instances of generated types. Include after the generated
+// headers and unity.h.
+
+#ifndef NUNAVUT_VERIFICATION_ROUND_TRIP_HELPERS_H_INCLUDED
+#define NUNAVUT_VERIFICATION_ROUND_TRIP_HELPERS_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/// SplitMix64 for NunavutRandom::next; user_reference points to the uint64_t state.
+static inline uint64_t splitMix64(void* const user_reference)
+{
+    uint64_t* const state = (uint64_t*) user_reference;
+    uint64_t        z     = (*state += 0x9E3779B97F4A7C15ULL);
+    z                     = (z ^ (z >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+    z                     = (z ^ (z >> 27U)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31U);
+}
+
+/// Deserializers for ROUND_TRIP_CHECK. The context argument is not used.
+#define ROUND_TRIP_DESERIALIZE(type_, obj_, buffer_, inout_size_, context_) \
+    type_##_deserialize_((obj_), (buffer_), (inout_size_))
+#define ROUND_TRIP_DESERIALIZE_TRUSTED(type_, obj_, buffer_, inout_size_, context_) \
+    type_##_deserialize_trusted_((obj_), (buffer_), (inout_size_))
+
+/*
+ * Serializes *ref_, reads the bytes back into *obj_ with deserialize_(type_, obj, buffer, inout_size, context_) and
+ * checks that every byte was consumed and that *obj_ serializes to the same bytes. The serialized forms are compared
+ * since inactive elements are left uninitialized.
+ */
+#define ROUND_TRIP_CHECK(type_, ref_, obj_, deserialize_, context_)                                \
+    do                                                                                             \
+    {                                                                                              \
+        uint8_t buf_a[type_##_SERIALIZATION_BUFFER_SIZE_BYTES_];                                   \
+        uint8_t buf_b[type_##_SERIALIZATION_BUFFER_SIZE_BYTES_];                                   \
+        size_t  size_a = sizeof(buf_a);                                                            \
+        size_t  size_b = sizeof(buf_b);                                                            \
+        TEST_ASSERT_EQUAL(0, type_##_serialize_((ref_), &buf_a[0], &size_a));                      \
+        size_t size_consumed = size_a;                                                             \
+        TEST_ASSERT_EQUAL(0, deserialize_(type_, (obj_), &buf_a[0], &size_consumed, context_));    \
+        TEST_ASSERT_EQUAL(size_a, size_consumed);                                                  \
+        TEST_ASSERT_EQUAL(0, type_##_serialize_((obj_), &buf_b[0], &size_b));                      \
+        TEST_ASSERT_EQUAL(size_a, size_b);                                                         \
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(buf_a, buf_b, size_a);                                       \
+    } while (false)
+
+/// Round-trips a randomized instance of type_ drawn from the NunavutRandom *rng_ with ROUND_TRIP_CHECK.
+#define ROUND_TRIP_RANDOM(type_, rng_, deserialize_)                                               \
+    do                                                                                             \
+    {                                                                                              \
+        type_ ref;                                                                                 \
+        type_ obj;                                                                                 \
+        type_##_randomize_(&ref, (rng_));                                                          \
+        ROUND_TRIP_CHECK(type_, &ref, &obj, deserialize_, NULL);                                   \
+    } while (false)
+
+#endif  // NUNAVUT_VERIFICATION_ROUND_TRIP_HELPERS_H_INCLUDED
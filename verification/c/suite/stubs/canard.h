@@ -0,0 +1,82 @@
+// Copyright (c) 2024 OpenCyphal Development Team.
+// This software is distributed under the terms of the MIT License.
+//
+// The subset of the libcanard v3 API used by the generated transport adapters. Only the declarations are provided;
+// the test defines canardTxPush() itself to capture the transfers.
+
+#ifndef CANARD_H_INCLUDED
+#define CANARD_H_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define CANARD_VERSION_MAJOR 3
+
+#define CANARD_NODE_ID_UNSET 255U
+#define CANARD_TRANSFER_ID_MAX 31U
+
+#define CANARD_ERROR_INVALID_ARGUMENT 2
+#define CANARD_ERROR_OUT_OF_MEMORY 3
+
+typedef uint64_t CanardMicrosecond;
+typedef uint16_t CanardPortID;
+typedef uint8_t  CanardNodeID;
+typedef uint8_t  CanardTransferID;
+
+typedef enum
+{
+    CanardPriorityExceptional = 0,
+    CanardPriorityImmediate   = 1,
+    CanardPriorityFast        = 2,
+    CanardPriorityHigh        = 3,
+    CanardPriorityNominal     = 4,
+    CanardPriorityLow         = 5,
+    CanardPrioritySlow        = 6,
+    CanardPriorityOptional    = 7,
+} CanardPriority;
+
+typedef enum
+{
+    CanardTransferKindMessage  = 0,
+    CanardTransferKindResponse = 1,
+    CanardTransferKindRequest  = 2,
+} CanardTransferKind;
+
+typedef struct
+{
+    CanardPriority     priority;
+    CanardTransferKind transfer_kind;
+    CanardPortID       port_id;
+    CanardNodeID       remote_node_id;
+    CanardTransferID   transfer_id;
+} CanardTransferMetadata;
+
+typedef struct CanardInstance CanardInstance;
+
+typedef void* (*CanardMemoryAllocate)(CanardInstance* ins, size_t amount);
+typedef void (*CanardMemoryFree)(CanardInstance* ins, void* pointer);
+
+struct CanardInstance
+{
+    void*                user_reference;
+    CanardNodeID         node_id;
+    CanardMemoryAllocate memory_allocate;
+    CanardMemoryFree     memory_free;
+};
+
+typedef struct CanardTxQueue
+{
+    size_t capacity;
+    size_t mtu_bytes;
+    size_t size;
+    void*  user_reference;
+} CanardTxQueue;
+
+int32_t canardTxPush(CanardTxQueue* const                que,
+                     CanardInstance* const               ins,
+                     const CanardMicrosecond             tx_deadline_usec,
+                     const CanardTransferMetadata* const metadata,
+                     const size_t                        payload_size,
+                     const void* const                   payload);
+
+#endif  // CANARD_H_INCLUDED
@@ -0,0 +1,69 @@
+// Copyright (c) 2024 OpenCyphal Development Team.
+// This software is distributed under the terms of the MIT License.
+//
+// The subset of the libudpard v1 API used by the generated transport adapters. Only the declarations are provided;
+// the test defines udpardTxPublish() itself to capture the transfers.
+
+#ifndef UDPARD_H_INCLUDED
+#define UDPARD_H_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define UDPARD_VERSION_MAJOR 1
+
+#define UDPARD_ERROR_ARGUMENT 2
+#define UDPARD_ERROR_MEMORY 3
+#define UDPARD_ERROR_CAPACITY 4
+
+typedef uint64_t UdpardMicrosecond;
+typedef uint16_t UdpardPortID;
+typedef uint16_t UdpardNodeID;
+typedef uint64_t UdpardTransferID;
+
+enum UdpardPriority
+{
+    UdpardPriorityExceptional = 0,
+    UdpardPriorityImmediate,
+    UdpardPriorityFast,
+    UdpardPriorityHigh,
+    UdpardPriorityNominal,
+    UdpardPriorityLow,
+    UdpardPrioritySlow,
+    UdpardPriorityOptional,
+};
+
+struct UdpardPayload
+{
+    size_t      size;
+    const void* data;
+};
+
+typedef void* (*UdpardMemoryAllocate)(void* const user_reference, const size_t size);
+typedef void (*UdpardMemoryDeallocate)(void* const user_reference, const size_t size, void* const pointer);
+
+struct UdpardMemoryResource
+{
+    void*                  user_reference;
+    UdpardMemoryDeallocate deallocate;
+    UdpardMemoryAllocate   allocate;
+};
+
+struct UdpardTx
+{
+    const UdpardNodeID*         local_node_id;
+    size_t                      queue_capacity;
+    size_t                      mtu;
+    struct UdpardMemoryResource memory;
+    size_t                      queue_size;
+};
+
+int32_t udpardTxPublish(struct UdpardTx* const     self,
+                        const UdpardMicrosecond    deadline_usec,
+                        const enum UdpardPriority  priority,
+                        const UdpardPortID         subject_id,
+                        UdpardTransferID* const    transfer_id,
+                        const struct UdpardPayload payload,
+                        void* const                user_transfer_reference);
+
+#endif  // UDPARD_H_INCLUDED
@@ -0,0 +1,64 @@
+// Copyright (c) 2024 OpenCyphal Development Team.
+// This software is distributed under the terms of the MIT License.
+//
+// Tests of <type>_deserialize_trusted_(). Built against the types generated with --enable-trusted-deserialization.
+
+#include <regulated/basics/Struct__0_1.h>
+#include <regulated/basics/Union_0_1.h>
+#include <regulated/basics/Primitive_0_1.h>
+#include <regulated/basics/PrimitiveArrayFixed_0_1.h>
+#include <regulated/basics/PrimitiveArrayVariable_0_1.h>
+#include <regulated/delimited/A_1_1.h>
+#include "unity.h"  // Include 3rd-party headers afterward to ensure that our headers are self-sufficient.
+#include "round_trip_helpers.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+ * The buffer produced by the serializer is read back with the unchecked <type>_deserialize_trusted_(), which must
+ * consume exactly what was written.
+ */
+static void testDeserializeTrusted(void)
+{
+    uint64_t      state = (uint64_t) rand();
+    NunavutRandom rng   = {&splitMix64, &state, NunavutRandomArrayLengthUniform};
+    for (uint32_t i = 0U; i < 100; i++)
+    {
+        ROUND_TRIP_RANDOM(regulated_basics_Primitive_0_1, &rng, ROUND_TRIP_DESERIALIZE_TRUSTED);
+        ROUND_TRIP_RANDOM(regulated_basics_PrimitiveArrayFixed_0_1, &rng, ROUND_TRIP_DESERIALIZE_TRUSTED);
+        ROUND_TRIP_RANDOM(regulated_basics_PrimitiveArrayVariable_0_1, &rng, ROUND_TRIP_DESERIALIZE_TRUSTED);
+        ROUND_TRIP_RANDOM(regulated_basics_Struct__0_1, &rng, ROUND_TRIP_DESERIALIZE_TRUSTED);
+        ROUND_TRIP_RANDOM(regulated_basics_Union_0_1, &rng, ROUND_TRIP_DESERIALIZE_TRUSTED);
+        ROUND_TRIP_RANDOM(regulated_delimited_A_1_1, &rng, ROUND_TRIP_DESERIALIZE_TRUSTED);
+    }
+    // Invalid arguments are still rejected.
+    regulated_basics_Primitive_0_1 obj;
+    size_t                         size = 0U;
+    TEST_ASSERT_EQUAL(-NUNAVUT_ERROR_INVALID_ARGUMENT,
+                      regulated_basics_Primitive_0_1_deserialize_trusted_(NULL, NULL, &size));
+    TEST_ASSERT_EQUAL(-NUNAVUT_ERROR_INVALID_ARGUMENT,
+                      regulated_basics_Primitive_0_1_deserialize_trusted_(&obj, NULL, NULL));
+}
+
+
+void setUp(void)
+{
+    const unsigned seed = (unsigned) time(NULL);
+    printf("Random seed in %s: srand(%u)\n", __FILE__, seed);
+    srand(seed);
+}
+
+void tearDown(void)
+{
+
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(testDeserializeTrusted);
+
+    return UNITY_END();
+}
@@ -0,0 +1,272 @@
+// Copyright (c) 2024 OpenCyphal Development Team.
+// This software is distributed under the terms of the MIT License.
+
+#include <mymsgs/ArrayUnion_1_0.h>
+#include <mymsgs/Inner_1_0.h>
+#include <mymsgs/InnerUnion_1_0.h>
+#include <mymsgs/Outer_1_0.h>
+#include <mymsgs/OuterMore_1_0.h>
+#include <mymsgs/Simple_1_0.h>
+#include "unity.h"  // Include 3rd-party headers afterward to ensure that our headers are self-sufficient.
+#include "round_trip_helpers.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/// Counts the outstanding allocations and fails every request once the budget is exhausted.
+typedef struct
+{
+    size_t allocated_bytes;
+    size_t allocated_blocks;
+    size_t budget;
+} TestHeap;
+
+static void* testHeapAllocate(void* const user_reference, const size_t size_bytes)
+{
+    TestHeap* const heap = (TestHeap*) user_reference;
+    TEST_ASSERT_TRUE(size_bytes > 0U);
+    if (heap->budget == 0U)
+    {
+        return NULL;
+    }
+    heap->budget--;
+    heap->allocated_bytes += size_bytes;
+    heap->allocated_blocks++;
+    return malloc(size_bytes);
+}
+
+static void testHeapDeallocate(void* const user_reference, const size_t size_bytes, void* const pointer)
+{
+    TestHeap* const heap = (TestHeap*) user_reference;
+    TEST_ASSERT_NOT_NULL(pointer);
+    TEST_ASSERT_TRUE(heap->allocated_bytes >= size_bytes);
+    TEST_ASSERT_TRUE(heap->allocated_blocks > 0U);
+    heap->allocated_bytes -= size_bytes;
+    heap->allocated_blocks--;
+    free(pointer);
+}
+
+/*
+ * Randomized instances survive a round trip through a second instance that is reused for several messages, so that
+ * its arrays both grow and shrink and its union switches options. Nothing is left on the heap after finalization.
+ */
+#define DESERIALIZE_DYNAMIC(type_, obj_, buffer_, inout_size_, allocator_) \
+    type_##_deserialize_((obj_), (buffer_), (inout_size_), (allocator_))
+#define DESERIALIZE_DYNAMIC_TRUSTED(type_, obj_, buffer_, inout_size_, allocator_) \
+    type_##_deserialize_trusted_((obj_), (buffer_), (inout_size_), (allocator_))
+
+#define ROUND_TRIP_DYNAMIC(type_, rng_, allocator_)                                                \
+    do                                                                                             \
+    {                                                                                              \
+        type_ ref;                                                                                 \
+        type_ obj;                                                                                 \
+        type_##_initialize_(&ref);                                                                 \
+        type_##_initialize_(&obj);                                                                 \
+        for (uint32_t k = 0U; k < 4U; k++)                                                         \
+        {                                                                                          \
+            type_##_randomize_(&ref, (rng_), (allocator_));                                        \
+            if ((k % 2U) == 0U)                                                                    \
+            {                                                                                      \
+                ROUND_TRIP_CHECK(type_, &ref, &obj, DESERIALIZE_DYNAMIC, (allocator_));            \
+            }                                                                                      \
+            else                                                                                   \
+            {                                                                                      \
+                ROUND_TRIP_CHECK(type_, &ref, &obj, DESERIALIZE_DYNAMIC_TRUSTED, (allocator_));    \
+            }                                                                                      \
+        }                                                                                          \
+        type_##_finalize_(&ref, (allocator_));                                                     \
+        type_##_finalize_(&obj, (allocator_));                                                     \
+    } while (false)
+
+static void testRoundTrip(void)
+{
+    TestHeap         heap      = {0U, 0U, SIZE_MAX};
+    NunavutAllocator allocator = {&heap, &testHeapAllocate, &testHeapDeallocate};
+    uint64_t         state     = (uint64_t) rand();
+    NunavutRandom    rng       = {&splitMix64, &state, NunavutRandomArrayLengthUniform};
+    for (uint32_t i = 0U; i < 100; i++)
+    {
+        ROUND_TRIP_DYNAMIC(mymsgs_ArrayUnion_1_0, &rng, &allocator);
+        ROUND_TRIP_DYNAMIC(mymsgs_Inner_1_0, &rng, &allocator);
+        ROUND_TRIP_DYNAMIC(mymsgs_InnerUnion_1_0, &rng, &allocator);
+        ROUND_TRIP_DYNAMIC(mymsgs_Outer_1_0, &rng, &allocator);
+        ROUND_TRIP_DYNAMIC(mymsgs_OuterMore_1_0, &rng, &allocator);
+        TEST_ASSERT_EQUAL(0U, heap.allocated_bytes);
+        TEST_ASSERT_EQUAL(0U, heap.allocated_blocks);
+    }
+}
+
+/*
+ * The storage of an array is sized to its length exactly, and an empty array holds no storage at all.
+ */
+static void testExactStorage(void)
+{
+    TestHeap         heap      = {0U, 0U, SIZE_MAX};
+    NunavutAllocator allocator = {&heap, &testHeapAllocate, &testHeapDeallocate};
+    mymsgs_Inner_1_0 obj;
+    mymsgs_Inner_1_0_initialize_(&obj);
+    TEST_ASSERT_NULL(obj.inner_items.elements);
+    TEST_ASSERT_EQUAL(0U, obj.inner_items.capacity);
+
+    // Three elements, then one, then none.
+    const uint8_t three[] = {3, 1, 0, 0, 0, 2, 0, 0, 0, 3, 0, 0, 0};
+    size_t        size    = sizeof(three);
+    TEST_ASSERT_EQUAL(0, mymsgs_Inner_1_0_deserialize_(&obj, &three[0], &size, &allocator));
+    TEST_ASSERT_EQUAL(3U, obj.inner_items.count);
+    TEST_ASSERT_EQUAL(3U, obj.inner_items.capacity);
+    TEST_ASSERT_EQUAL(3U * sizeof(uint32_t), heap.allocated_bytes);
+    TEST_ASSERT_EQUAL(3U, obj.inner_items.elements[2]);
+
+    const uint8_t one[] = {1, 7, 0, 0, 0};
+    size                = sizeof(one);
+    TEST_ASSERT_EQUAL(0, mymsgs_Inner_1_0_deserialize_(&obj, &one[0], &size, &allocator));
+    TEST_ASSERT_EQUAL(1U, obj.inner_items.capacity);
+    TEST_ASSERT_EQUAL(sizeof(uint32_t), heap.allocated_bytes);
+    TEST_ASSERT_EQUAL(7U, obj.inner_items.elements[0]);
+
+    size = 0U;
+    TEST_ASSERT_EQUAL(0, mymsgs_Inner_1_0_deserialize_(&obj, NULL, &size, &allocator));
+    TEST_ASSERT_EQUAL(0U, obj.inner_items.count);
+    TEST_ASSERT_NULL(obj.inner_items.elements);
+    TEST_ASSERT_EQUAL(0U, heap.allocated_blocks);
+
+    mymsgs_Inner_1_0_finalize_(&obj, &allocator);
+    mymsgs_Inner_1_0_finalize_(NULL, &allocator);
+}
+
+/*
+ * A union option that owns storage is initialized once it is selected: it aliases the first option, which is the only
+ * one that initialization writes. An array whose count exceeds its storage is not serialized.
+ */
+static void testUnionOption(void)
+{
+    TestHeap              heap      = {0U, 0U, SIZE_MAX};
+    NunavutAllocator      allocator = {&heap, &testHeapAllocate, &testHeapDeallocate};
+    uint64_t              state     = (uint64_t) rand();
+    NunavutRandom         rng       = {&splitMix64, &state, NunavutRandomArrayLengthUniform};
+    mymsgs_ArrayUnion_1_0 obj;
+    (void) memset(&obj, 0xA5, sizeof(obj));
+    mymsgs_ArrayUnion_1_0_initialize_(&obj);
+
+    const uint8_t three[] = {1, 3, 10, 20, 30};
+    size_t        size    = sizeof(three);
+    TEST_ASSERT_EQUAL(0, mymsgs_ArrayUnion_1_0_deserialize_(&obj, &three[0], &size, &allocator));
+    TEST_ASSERT_TRUE(mymsgs_ArrayUnion_1_0_is_a_(&obj));
+    TEST_ASSERT_EQUAL(3U, obj.a.count);
+    TEST_ASSERT_EQUAL(3U, obj.a.capacity);
+    TEST_ASSERT_EQUAL(3U, heap.allocated_bytes);
+    TEST_ASSERT_EQUAL(30U, obj.a.elements[2]);
+
+    // Selecting the first option again returns the storage.
+    const uint8_t x[] = {0, 42};
+    size              = sizeof(x);
+    TEST_ASSERT_EQUAL(0, mymsgs_ArrayUnion_1_0_deserialize_(&obj, &x[0], &size, &allocator));
+    TEST_ASSERT_TRUE(mymsgs_ArrayUnion_1_0_is_x_(&obj));
+    TEST_ASSERT_EQUAL(42U, obj.x);
+    TEST_ASSERT_EQUAL(0U, heap.allocated_blocks);
+
+    (void) memset(&obj, 0xA5, sizeof(obj));
+    mymsgs_ArrayUnion_1_0_initialize_(&obj);
+    for (uint32_t i = 0U; i < 100; i++)
+    {
+        uint8_t buf[mymsgs_ArrayUnion_1_0_SERIALIZATION_BUFFER_SIZE_BYTES_];
+        size = sizeof(buf);
+        mymsgs_ArrayUnion_1_0_randomize_(&obj, &rng, &allocator);
+        TEST_ASSERT_EQUAL(0, mymsgs_ArrayUnion_1_0_serialize_(&obj, &buf[0], &size));
+    }
+    mymsgs_ArrayUnion_1_0_finalize_(&obj, &allocator);
+    TEST_ASSERT_EQUAL(0U, heap.allocated_blocks);
+
+    uint8_t buf[mymsgs_ArrayUnion_1_0_SERIALIZATION_BUFFER_SIZE_BYTES_];
+    size = sizeof(buf);
+    mymsgs_ArrayUnion_1_0_select_a_(&obj);
+    obj.a.elements = NULL;
+    obj.a.count    = 1U;
+    obj.a.capacity = 0U;
+    TEST_ASSERT_EQUAL(-NUNAVUT_ERROR_REPRESENTATION_BAD_ARRAY_LENGTH,
+                      mymsgs_ArrayUnion_1_0_serialize_(&obj, &buf[0], &size));
+}
+
+/*
+ * Running out of memory at any point leaves an instance that can still be serialized and finalized without leaks.
+ */
+static void testOutOfMemory(void)
+{
+    TestHeap         heap      = {0U, 0U, SIZE_MAX};
+    NunavutAllocator allocator = {&heap, &testHeapAllocate, &testHeapDeallocate};
+    uint64_t         state     = (uint64_t) rand();
+    NunavutRandom    rng       = {&splitMix64, &state, NunavutRandomArrayLengthFull};
+    mymsgs_OuterMore_1_0 ref;
+    mymsgs_OuterMore_1_0_initialize_(&ref);
+    mymsgs_OuterMore_1_0_randomize_(&ref, &rng, &allocator);
+    uint8_t buf[mymsgs_OuterMore_1_0_SERIALIZATION_BUFFER_SIZE_BYTES_];
+    size_t  size = sizeof(buf);
+    TEST_ASSERT_EQUAL(0, mymsgs_OuterMore_1_0_serialize_(&ref, &buf[0], &size));
+    const size_t reference_bytes = heap.allocated_bytes;
+
+    bool completed = false;
+    for (size_t budget = 0U; !completed; budget++)
+    {
+        mymsgs_OuterMore_1_0 obj;
+        mymsgs_OuterMore_1_0_initialize_(&obj);
+        heap.budget                = budget;
+        size_t       size_consumed = size;
+        const int8_t result        = mymsgs_OuterMore_1_0_deserialize_(&obj, &buf[0], &size_consumed, &allocator);
+        heap.budget                = SIZE_MAX;
+        completed                  = (result == 0);
+        if (!completed)
+        {
+            TEST_ASSERT_EQUAL(-NUNAVUT_ERROR_OUT_OF_MEMORY, result);
+            uint8_t partial[mymsgs_OuterMore_1_0_SERIALIZATION_BUFFER_SIZE_BYTES_];
+            size_t  partial_size = sizeof(partial);
+            TEST_ASSERT_EQUAL(0, mymsgs_OuterMore_1_0_serialize_(&obj, &partial[0], &partial_size));
+        }
+        mymsgs_OuterMore_1_0_finalize_(&obj, &allocator);
+        TEST_ASSERT_EQUAL(reference_bytes, heap.allocated_bytes);
+    }
+    mymsgs_OuterMore_1_0_finalize_(&ref, &allocator);
+    TEST_ASSERT_EQUAL(0U, heap.allocated_blocks);
+}
+
+/*
+ * The allocator is mandatory for types with variable-length arrays only.
+ */
+static void testNullAllocator(void)
+{
+    mymsgs_Simple_1_0 simple;
+    mymsgs_Simple_1_0_initialize_(&simple);
+    size_t size = 0U;
+    TEST_ASSERT_EQUAL(0, mymsgs_Simple_1_0_deserialize_(&simple, NULL, &size, NULL));
+    mymsgs_Simple_1_0_finalize_(&simple, NULL);
+
+    mymsgs_Outer_1_0 outer;
+    mymsgs_Outer_1_0_initialize_(&outer);
+    size = 0U;
+    TEST_ASSERT_EQUAL(-NUNAVUT_ERROR_INVALID_ARGUMENT, mymsgs_Outer_1_0_deserialize_(&outer, NULL, &size, NULL));
+}
+
+
+void setUp(void)
+{
+    const unsigned seed = (unsigned) time(NULL);
+    printf("Random seed in %s: srand(%u)\n", __FILE__, seed);
+    srand(seed);
+}
+
+void tearDown(void)
+{
+
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(testRoundTrip);
+    RUN_TEST(testExactStorage);
+    RUN_TEST(testUnionOption);
+    RUN_TEST(testOutOfMemory);
+    RUN_TEST(testNullAllocator);
+
+    return UNITY_END();
+}
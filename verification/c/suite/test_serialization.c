@@ -10,6 +10,7 @@
 #include <regulated/delimited/A_1_1.h>
 #include <uavcan/pnp/NodeIDAllocationData_2_0.h>
 #include "unity.h"  // Include 3rd-party headers afterward to ensure that our headers are self-sufficient.
+#include "round_trip_helpers.h"
 #include <stdlib.h>
 #include <time.h>
 
@@ -886,6 +887,62 @@ static void testIssue221_zeroExtensionRule(void)
     TEST_ASSERT_EQUAL(0, obj.node_id.value);
 }
 
+/*
+ * Randomized instances must stay within the value ranges of their DSDL types.
+ */
+static void testRandomizePrimitiveRanges(void)
+{
+    uint64_t      state = (uint64_t) rand();
+    NunavutRandom rng   = {&splitMix64, &state, NunavutRandomArrayLengthUniform};
+    for (uint32_t i = 0U; i < 1000; i++)
+    {
+        regulated_basics_Primitive_0_1 obj;
+        regulated_basics_Primitive_0_1_randomize_(&obj, &rng);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT8(127U, obj.a_u7);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT8(127U, obj.n_u7);
+        TEST_ASSERT_TRUE(obj.a_i7 >= -64 && obj.a_i7 <= 63);
+        TEST_ASSERT_TRUE(obj.n_i7 >= -64 && obj.n_i7 <= 63);
+        TEST_ASSERT_TRUE(isfinite(obj.a_f16) && (fabsf(obj.a_f16) <= 65504.0F));
+        TEST_ASSERT_TRUE(isfinite(obj.a_f32));
+        TEST_ASSERT_TRUE(isfinite(obj.a_f64));
+    }
+    // Null arguments are ignored.
+    regulated_basics_Primitive_0_1_randomize_(NULL, &rng);
+}
+
+/*
+ * Randomized instances serialize without error and survive a round trip through deserialize_.
+ */
+static void testRandomizeRoundTrip(void)
+{
+    const NunavutRandomArrayLength distributions[] = {NunavutRandomArrayLengthUniform,
+                                                      NunavutRandomArrayLengthShort,
+                                                      NunavutRandomArrayLengthEmpty,
+                                                      NunavutRandomArrayLengthFull};
+    uint64_t      state = (uint64_t) rand();
+    NunavutRandom rng   = {&splitMix64, &state, NunavutRandomArrayLengthUniform};
+    for (size_t d = 0U; d < sizeof(distributions) / sizeof(distributions[0]); d++)
+    {
+        rng.array_length = distributions[d];
+        for (uint32_t i = 0U; i < 100; i++)
+        {
+            ROUND_TRIP_RANDOM(regulated_basics_Primitive_0_1, &rng, ROUND_TRIP_DESERIALIZE);
+            ROUND_TRIP_RANDOM(regulated_basics_PrimitiveArrayFixed_0_1, &rng, ROUND_TRIP_DESERIALIZE);
+            ROUND_TRIP_RANDOM(regulated_basics_PrimitiveArrayVariable_0_1, &rng, ROUND_TRIP_DESERIALIZE);
+            ROUND_TRIP_RANDOM(regulated_basics_Struct__0_1, &rng, ROUND_TRIP_DESERIALIZE);
+            ROUND_TRIP_RANDOM(regulated_basics_Union_0_1, &rng, ROUND_TRIP_DESERIALIZE);
+            ROUND_TRIP_RANDOM(regulated_delimited_A_1_1, &rng, ROUND_TRIP_DESERIALIZE);
+        }
+    }
+    regulated_basics_PrimitiveArrayVariable_0_1 obj;
+    rng.array_length = NunavutRandomArrayLengthFull;
+    regulated_basics_PrimitiveArrayVariable_0_1_randomize_(&obj, &rng);
+    TEST_ASSERT_EQUAL(regulated_basics_PrimitiveArrayVariable_0_1_a_u64_ARRAY_CAPACITY_, obj.a_u64.count);
+    rng.array_length = NunavutRandomArrayLengthEmpty;
+    regulated_basics_PrimitiveArrayVariable_0_1_randomize_(&obj, &rng);
+    TEST_ASSERT_EQUAL(0U, obj.a_u64.count);
+}
+
 
 void setUp(void)
 {
@@ -911,6 +968,8 @@ int main(void)
     RUN_TEST(testPrimitiveArrayVariable);
     RUN_TEST(testIssue221);
     RUN_TEST(testIssue221_zeroExtensionRule);
+    RUN_TEST(testRandomizePrimitiveRanges);
+    RUN_TEST(testRandomizeRoundTrip);
 
     return UNITY_END();
 }
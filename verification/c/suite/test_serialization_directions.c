@@ -0,0 +1,80 @@
+// Copyright (c) 2024 OpenCyphal Development Team.
+// This software is distributed under the terms of the MIT License.
+//
+// Builds the regulated types generated with --serialization-direction *=deserialize and checks that they still
+// deserialize. Nothing here may serialize: the declarations below only compile if the generator left out the
+// serialization functions of the types and the serialization primitives of the support header.
+
+#include <uavcan/node/Heartbeat_1_0.h>
+#include <uavcan/primitive/array/Real16_1_0.h>
+#include "unity.h"
+
+static inline int8_t uavcan_node_Heartbeat_1_0_serialize_(void)
+{
+    return 0;
+}
+
+static inline int8_t uavcan_primitive_array_Real16_1_0_serialize_(void)
+{
+    return 0;
+}
+
+static inline int8_t nunavutSetUxx(void)
+{
+    return 0;
+}
+
+static inline int8_t nunavutSetF16(void)
+{
+    return 0;
+}
+
+static void testDeserializeHeartbeat(void)
+{
+    const uint8_t buffer[] = {0x78, 0x56, 0x34, 0x12, uavcan_node_Health_1_0_CAUTION,
+                              uavcan_node_Mode_1_0_SOFTWARE_UPDATE, 0xAB};
+    TEST_ASSERT_EQUAL(uavcan_node_Heartbeat_1_0_SERIALIZATION_BUFFER_SIZE_BYTES_, sizeof(buffer));
+
+    uavcan_node_Heartbeat_1_0 obj;
+    size_t size = sizeof(buffer);
+    TEST_ASSERT_EQUAL(NUNAVUT_SUCCESS, uavcan_node_Heartbeat_1_0_deserialize_(&obj, buffer, &size));
+    TEST_ASSERT_EQUAL(sizeof(buffer), size);
+    TEST_ASSERT_EQUAL_UINT32(0x12345678UL, obj.uptime);
+    TEST_ASSERT_EQUAL(uavcan_node_Health_1_0_CAUTION, obj.health.value);
+    TEST_ASSERT_EQUAL(uavcan_node_Mode_1_0_SOFTWARE_UPDATE, obj.mode.value);
+    TEST_ASSERT_EQUAL(0xAB, obj.vendor_specific_status_code);
+}
+
+static void testDeserializeReal16Array(void)
+{
+    // Two elements: 1.0 and -2.0 as little-endian binary16.
+    const uint8_t buffer[] = {2, 0x00, 0x3C, 0x00, 0xC0};
+
+    uavcan_primitive_array_Real16_1_0 obj;
+    size_t size = sizeof(buffer);
+    TEST_ASSERT_EQUAL(NUNAVUT_SUCCESS, uavcan_primitive_array_Real16_1_0_deserialize_(&obj, buffer, &size));
+    TEST_ASSERT_EQUAL(sizeof(buffer), size);
+    TEST_ASSERT_EQUAL(2U, obj.value.count);
+    TEST_ASSERT_EQUAL_FLOAT(1.0F, obj.value.elements[0]);
+    TEST_ASSERT_EQUAL_FLOAT(-2.0F, obj.value.elements[1]);
+}
+
+void setUp(void)
+{
+
+}
+
+void tearDown(void)
+{
+
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(testDeserializeHeartbeat);
+    RUN_TEST(testDeserializeReal16Array);
+
+    return UNITY_END();
+}
@@ -212,6 +212,19 @@ static void testNunavutSetIxx_bufferOverflow(void)
     TEST_ASSERT_EQUAL_HEX8(0xAA, buffer[2]);
 }
 
+static void testNunavutSetDelimiterHeader(void)
+{
+    uint8_t buffer[] = {0xAA, 0x00, 0x00, 0x00, 0x00, 0xAA};
+    nunavutSetDelimiterHeader(&buffer[1], 0x12345678UL);
+    TEST_ASSERT_EQUAL_HEX8(0xAA, buffer[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x78, buffer[1]);
+    TEST_ASSERT_EQUAL_HEX8(0x56, buffer[2]);
+    TEST_ASSERT_EQUAL_HEX8(0x34, buffer[3]);
+    TEST_ASSERT_EQUAL_HEX8(0x12, buffer[4]);
+    TEST_ASSERT_EQUAL_HEX8(0xAA, buffer[5]);
+    TEST_ASSERT_EQUAL_UINT32(0x12345678UL, nunavutGetU32(buffer, sizeof(buffer), 8U, 32U));
+}
+
 // +--------------------------------------------------------------------------+
 // | nunavut[Get|Set]Bit
 // +--------------------------------------------------------------------------+
@@ -796,6 +809,7 @@ int main(void)
     RUN_TEST(testNunavutSetIxx_neg255);
     RUN_TEST(testNunavutSetIxx_neg255_tooSmall);
     RUN_TEST(testNunavutSetIxx_bufferOverflow);
+    RUN_TEST(testNunavutSetDelimiterHeader);
     RUN_TEST(testNunavutSetBit);
     RUN_TEST(testNunavutSetBit_bufferOverflow);
     RUN_TEST(testNunavutGetBit);
@@ -0,0 +1,303 @@
+// Copyright (c) 2024 OpenCyphal Development Team.
+// This software is distributed under the terms of the MIT License.
+//
+// Builds the publish adapters that --enable-transport-adapters emits against the libcanard and libudpard APIs and
+// checks what they hand to the transport. The transport headers have to be included before the generated ones.
+// With NUNAVUT_VERIFICATION_TRANSPORT_LIBRARIES defined the real libcanard and libudpard headers are used instead of the
+// API subsets in stubs/; the push functions are still the ones defined below.
+
+#ifdef NUNAVUT_VERIFICATION_TRANSPORT_LIBRARIES
+#    include <canard.h>
+#    include <udpard.h>
+#else
+#    include "stubs/canard.h"
+#    include "stubs/udpard.h"
+#endif
+#include <uavcan/node/Heartbeat_1_0.h>
+#include <uavcan/primitive/String_1_0.h>
+#include "unity.h"
+#include <stdlib.h>
+#include <string.h>
+
+/// The last transfer pushed to either transport and the result the push reports.
+static struct
+{
+    size_t             pushes;
+    int32_t            result;
+    CanardTransferMetadata canard_metadata;
+    enum UdpardPriority    udpard_priority;
+    UdpardPortID           udpard_subject_id;
+    UdpardTransferID       udpard_transfer_id;
+    size_t                 payload_size;
+    uint8_t                payload[uavcan_primitive_String_1_0_SERIALIZATION_BUFFER_SIZE_BYTES_];
+} transport;
+
+/// Outstanding allocations of the transport memory resources; allocations fail while fail_allocations is set.
+static struct
+{
+    size_t blocks;
+    bool   fail_allocations;
+} heap;
+
+static void* heapAllocate(const size_t size)
+{
+    if (heap.fail_allocations)
+    {
+        return NULL;
+    }
+    heap.blocks++;
+    return malloc(size);
+}
+
+static void heapFree(void* const pointer)
+{
+    TEST_ASSERT_NOT_NULL(pointer);
+    TEST_ASSERT_TRUE(heap.blocks > 0U);
+    heap.blocks--;
+    free(pointer);
+}
+
+static void capturePayload(const size_t payload_size, const void* const payload)
+{
+    TEST_ASSERT_TRUE(payload_size <= sizeof(transport.payload));
+    transport.pushes++;
+    transport.payload_size = payload_size;
+    (void) memcpy(&transport.payload[0], payload, payload_size);
+}
+
+int32_t canardTxPush(CanardTxQueue* const                que,
+                     CanardInstance* const               ins,
+                     const CanardMicrosecond             tx_deadline_usec,
+                     const CanardTransferMetadata* const metadata,
+                     const size_t                        payload_size,
+                     const void* const                   payload)
+{
+    (void) que;
+    (void) ins;
+    TEST_ASSERT_EQUAL_UINT64(1000U, tx_deadline_usec);
+    transport.canard_metadata = *metadata;
+    capturePayload(payload_size, payload);
+    return transport.result;
+}
+
+int32_t udpardTxPublish(struct UdpardTx* const     self,
+                        const UdpardMicrosecond    deadline_usec,
+                        const enum UdpardPriority  priority,
+                        const UdpardPortID         subject_id,
+                        UdpardTransferID* const    transfer_id,
+                        const struct UdpardPayload payload,
+                        void* const                user_transfer_reference)
+{
+    (void) self;
+    TEST_ASSERT_EQUAL_UINT64(1000U, deadline_usec);
+    TEST_ASSERT_NULL(user_transfer_reference);
+    transport.udpard_priority    = priority;
+    transport.udpard_subject_id  = subject_id;
+    transport.udpard_transfer_id = *transfer_id;
+    capturePayload(payload.size, payload.data);
+    if (transport.result > 0)
+    {
+        (*transfer_id)++;
+    }
+    return transport.result;
+}
+
+static void* canardAllocate(CanardInstance* const ins, const size_t amount)
+{
+    (void) ins;
+    return heapAllocate(amount);
+}
+
+static void canardFree(CanardInstance* const ins, void* const pointer)
+{
+    (void) ins;
+    heapFree(pointer);
+}
+
+static void* udpardAllocate(void* const user_reference, const size_t size)
+{
+    (void) user_reference;
+    return heapAllocate(size);
+}
+
+static void udpardDeallocate(void* const user_reference, const size_t size, void* const pointer)
+{
+    (void) user_reference;
+    (void) size;
+    heapFree(pointer);
+}
+
+static void makeHeartbeat(uavcan_node_Heartbeat_1_0* const obj, uint8_t* const buffer, size_t* const size)
+{
+    uavcan_node_Heartbeat_1_0_initialize_(obj);
+    obj->uptime                      = 123456U;
+    obj->health.value                = 1U;
+    obj->mode.value                  = 2U;
+    obj->vendor_specific_status_code = 0xA5U;
+    TEST_ASSERT_EQUAL(0, uavcan_node_Heartbeat_1_0_serialize_(obj, buffer, size));
+}
+
+/*
+ * A message with a fixed port-ID is pushed to it with the serialized representation of the object, and the
+ * transfer-ID wraps around.
+ */
+static void testCanardPublish(void)
+{
+    uint8_t                   reference[uavcan_node_Heartbeat_1_0_SERIALIZATION_BUFFER_SIZE_BYTES_];
+    size_t                    reference_size = sizeof(reference);
+    uavcan_node_Heartbeat_1_0 obj;
+    makeHeartbeat(&obj, &reference[0], &reference_size);
+
+    CanardInstance   ins         = {.node_id = 42U, .memory_allocate = &canardAllocate, .memory_free = &canardFree};
+    CanardTxQueue    que         = {.capacity = 100U, .mtu_bytes = 8U};
+    CanardTransferID transfer_id = CANARD_TRANSFER_ID_MAX;
+    transport.result             = 1;
+    TEST_ASSERT_EQUAL(1,
+                      uavcan_node_Heartbeat_1_0_canard_publish_(&que,
+                                                                &ins,
+                                                                1000U,
+                                                                CanardPriorityNominal,
+                                                                &transfer_id,
+                                                                &obj));
+    TEST_ASSERT_EQUAL(0U, transfer_id);
+    TEST_ASSERT_EQUAL(CanardPriorityNominal, transport.canard_metadata.priority);
+    TEST_ASSERT_EQUAL(CanardTransferKindMessage, transport.canard_metadata.transfer_kind);
+    TEST_ASSERT_EQUAL(uavcan_node_Heartbeat_1_0_FIXED_PORT_ID_, transport.canard_metadata.port_id);
+    TEST_ASSERT_EQUAL(CANARD_NODE_ID_UNSET, transport.canard_metadata.remote_node_id);
+    TEST_ASSERT_EQUAL(CANARD_TRANSFER_ID_MAX, transport.canard_metadata.transfer_id);
+    TEST_ASSERT_EQUAL(reference_size, transport.payload_size);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(reference, transport.payload, reference_size);
+    TEST_ASSERT_EQUAL(0U, heap.blocks);
+
+    // A message without a fixed port-ID goes to the subject given.
+    uavcan_primitive_String_1_0 text;
+    uavcan_primitive_String_1_0_initialize_(&text);
+    text.value.count = 3U;
+    (void) memcpy(&text.value.elements[0], "abc", 3U);
+    TEST_ASSERT_EQUAL(1,
+                      uavcan_primitive_String_1_0_canard_publish_(&que,
+                                                                  &ins,
+                                                                  1000U,
+                                                                  CanardPriorityLow,
+                                                                  1234U,
+                                                                  &transfer_id,
+                                                                  &text));
+    TEST_ASSERT_EQUAL(1U, transfer_id);
+    TEST_ASSERT_EQUAL(1234U, transport.canard_metadata.port_id);
+    TEST_ASSERT_EQUAL(5U, transport.payload_size);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY("\x03\x00" "abc", transport.payload, 5U);
+    TEST_ASSERT_EQUAL(0U, heap.blocks);
+}
+
+/*
+ * Errors of the transport and of serialization can be told apart, and leave the transfer-ID and the heap unchanged.
+ */
+static void testCanardErrors(void)
+{
+    uint8_t                   reference[uavcan_node_Heartbeat_1_0_SERIALIZATION_BUFFER_SIZE_BYTES_];
+    size_t                    reference_size = sizeof(reference);
+    uavcan_node_Heartbeat_1_0 obj;
+    makeHeartbeat(&obj, &reference[0], &reference_size);
+
+    CanardInstance   ins         = {.node_id = 42U, .memory_allocate = &canardAllocate, .memory_free = &canardFree};
+    CanardTxQueue    que         = {.capacity = 100U, .mtu_bytes = 8U};
+    CanardTransferID transfer_id = 7U;
+    TEST_ASSERT_EQUAL(-CANARD_ERROR_INVALID_ARGUMENT,
+                      uavcan_node_Heartbeat_1_0_canard_publish_(NULL, &ins, 1000U, CanardPriorityNominal,
+                                                                &transfer_id, &obj));
+    TEST_ASSERT_EQUAL(-CANARD_ERROR_INVALID_ARGUMENT,
+                      uavcan_node_Heartbeat_1_0_canard_publish_(&que, &ins, 1000U, CanardPriorityNominal,
+                                                                &transfer_id, NULL));
+
+    heap.fail_allocations = true;
+    TEST_ASSERT_EQUAL(-CANARD_ERROR_OUT_OF_MEMORY,
+                      uavcan_node_Heartbeat_1_0_canard_publish_(&que, &ins, 1000U, CanardPriorityNominal,
+                                                                &transfer_id, &obj));
+    heap.fail_allocations = false;
+
+    transport.result = -CANARD_ERROR_OUT_OF_MEMORY;
+    TEST_ASSERT_EQUAL(-CANARD_ERROR_OUT_OF_MEMORY,
+                      uavcan_node_Heartbeat_1_0_canard_publish_(&que, &ins, 1000U, CanardPriorityNominal,
+                                                                &transfer_id, &obj));
+    TEST_ASSERT_EQUAL(0U, heap.blocks);
+
+    const size_t                pushes = transport.pushes;
+    uavcan_primitive_String_1_0 text;
+    uavcan_primitive_String_1_0_initialize_(&text);
+    text.value.count = uavcan_primitive_String_1_0_value_ARRAY_CAPACITY_ + 1U;
+    TEST_ASSERT_EQUAL(-(NUNAVUT_ERROR_TRANSPORT_ADAPTER_BASE + NUNAVUT_ERROR_REPRESENTATION_BAD_ARRAY_LENGTH),
+                      uavcan_primitive_String_1_0_canard_publish_(&que, &ins, 1000U, CanardPriorityNominal, 1234U,
+                                                                  &transfer_id, &text));
+    TEST_ASSERT_EQUAL(pushes, transport.pushes);
+    TEST_ASSERT_EQUAL(7U, transfer_id);
+    TEST_ASSERT_EQUAL(0U, heap.blocks);
+}
+
+static void testUdpardPublish(void)
+{
+    uint8_t                   reference[uavcan_node_Heartbeat_1_0_SERIALIZATION_BUFFER_SIZE_BYTES_];
+    size_t                    reference_size = sizeof(reference);
+    uavcan_node_Heartbeat_1_0 obj;
+    makeHeartbeat(&obj, &reference[0], &reference_size);
+
+    const UdpardNodeID node_id     = 42U;
+    struct UdpardTx    tx          = {.local_node_id  = &node_id,
+                                      .queue_capacity = 100U,
+                                      .mtu            = 1408U,
+                                      .memory = {.deallocate = &udpardDeallocate, .allocate = &udpardAllocate}};
+    UdpardTransferID   transfer_id = 1000U;
+    transport.result               = 1;
+    TEST_ASSERT_EQUAL(1,
+                      uavcan_node_Heartbeat_1_0_udpard_publish_(&tx,
+                                                                1000U,
+                                                                UdpardPriorityHigh,
+                                                                &transfer_id,
+                                                                &obj,
+                                                                NULL));
+    TEST_ASSERT_EQUAL_UINT64(1001U, transfer_id);
+    TEST_ASSERT_EQUAL_UINT64(1000U, transport.udpard_transfer_id);
+    TEST_ASSERT_EQUAL(UdpardPriorityHigh, transport.udpard_priority);
+    TEST_ASSERT_EQUAL(uavcan_node_Heartbeat_1_0_FIXED_PORT_ID_, transport.udpard_subject_id);
+    TEST_ASSERT_EQUAL(reference_size, transport.payload_size);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(reference, transport.payload, reference_size);
+    TEST_ASSERT_EQUAL(0U, heap.blocks);
+
+    TEST_ASSERT_EQUAL(-UDPARD_ERROR_ARGUMENT,
+                      uavcan_node_Heartbeat_1_0_udpard_publish_(&tx, 1000U, UdpardPriorityHigh, NULL, &obj, NULL));
+    heap.fail_allocations = true;
+    TEST_ASSERT_EQUAL(-UDPARD_ERROR_MEMORY,
+                      uavcan_node_Heartbeat_1_0_udpard_publish_(&tx, 1000U, UdpardPriorityHigh, &transfer_id, &obj,
+                                                                NULL));
+    heap.fail_allocations = false;
+
+    uavcan_primitive_String_1_0 text;
+    uavcan_primitive_String_1_0_initialize_(&text);
+    text.value.count = uavcan_primitive_String_1_0_value_ARRAY_CAPACITY_ + 1U;
+    TEST_ASSERT_EQUAL(-(NUNAVUT_ERROR_TRANSPORT_ADAPTER_BASE + NUNAVUT_ERROR_REPRESENTATION_BAD_ARRAY_LENGTH),
+                      uavcan_primitive_String_1_0_udpard_publish_(&tx, 1000U, UdpardPriorityHigh, 1234U,
+                                                                  &transfer_id, &text, NULL));
+    TEST_ASSERT_EQUAL_UINT64(1001U, transfer_id);
+    TEST_ASSERT_EQUAL(0U, heap.blocks);
+}
+
+void setUp(void)
+{
+    (void) memset(&transport, 0, sizeof(transport));
+    (void) memset(&heap, 0, sizeof(heap));
+}
+
+void tearDown(void)
+{
+
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(testCanardPublish);
+    RUN_TEST(testCanardErrors);
+    RUN_TEST(testUdpardPublish);
+
+    return UNITY_END();
+}
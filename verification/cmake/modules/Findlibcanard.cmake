@@ -0,0 +1,19 @@
+#
+# Framework : libcanard
+# Homepage: https://github.com/OpenCyphal/libcanard.git
+#
+# Optional. Set LIBCANARD_ROOT to a libcanard v3 checkout to build the generated transport adapters against its
+# header; it defaults to ${NUNAVUT_SUBMODULES_ROOT}/libcanard.
+#
+
+set(LIBCANARD_ROOT "${NUNAVUT_SUBMODULES_ROOT}/libcanard" CACHE PATH "A libcanard v3 checkout.")
+
+if(EXISTS "${LIBCANARD_ROOT}/libcanard/canard.h")
+    set(LIBCANARD_INCLUDE_DIR "${LIBCANARD_ROOT}/libcanard")
+endif()
+
+include(FindPackageHandleStandardArgs)
+
+find_package_handle_standard_args(libcanard
+    REQUIRED_VARS LIBCANARD_INCLUDE_DIR
+)
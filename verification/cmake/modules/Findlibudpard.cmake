@@ -0,0 +1,19 @@
+#
+# Framework : libudpard
+# Homepage: https://github.com/OpenCyphal-Garage/libudpard.git
+#
+# Optional. Set LIBUDPARD_ROOT to a libudpard v1 checkout to build the generated transport adapters against its
+# header; it defaults to ${NUNAVUT_SUBMODULES_ROOT}/libudpard.
+#
+
+set(LIBUDPARD_ROOT "${NUNAVUT_SUBMODULES_ROOT}/libudpard" CACHE PATH "A libudpard v1 checkout.")
+
+if(EXISTS "${LIBUDPARD_ROOT}/libudpard/udpard.h")
+    set(LIBUDPARD_INCLUDE_DIR "${LIBUDPARD_ROOT}/libudpard")
+endif()
+
+include(FindPackageHandleStandardArgs)
+
+find_package_handle_standard_args(libudpard
+    REQUIRED_VARS LIBUDPARD_INCLUDE_DIR
+)
@@ -0,0 +1,498 @@
+/*
+ * Copyright (c) 2024 OpenCyphal Development Team.
+ * This software is distributed under the terms of the MIT License.
+ *
+ * End-to-end publish/subscribe latency benchmark for generated C++ types. Not part of test_all; build and run with the
+ * bench_loopback target (or run_bench_loopback).
+ *
+ * A publisher thread serializes a randomly filled object, splits it into datagrams of at most --mtu payload bytes
+ * (1408 by default, as for Cyphal/UDP) and sends them to a subscriber thread which reassembles the transfer,
+ * deserializes it and acknowledges it. Only one transfer is in flight at a time so the latency of a transfer is the
+ * time from the start of serialization to the end of deserialization, and the throughput is the closed-loop rate.
+ *
+ * By default the datagrams go over a Unix datagram socket pair, which is reliable and applies back-pressure. Pass
+ * --udp to use UDP sockets on 127.0.0.1 instead; transfers with lost frames are then counted but not retried. In both
+ * cases nothing leaves the host. --type, --iterations and --list work as for bench_serialization.
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include "regulated/basics/Primitive_0_1.hpp"
+#include "regulated/basics/PrimitiveArrayFixed_0_1.hpp"
+#include "regulated/basics/PrimitiveArrayVariable_0_1.hpp"
+#include "regulated/basics/Struct__0_1.hpp"
+#include "regulated/basics/Union_0_1.hpp"
+#include "regulated/RGB888_3840x2748_0_1.hpp"
+#include "uavcan/node/Heartbeat_1_0.hpp"
+#include "bench_helpers.h"
+
+namespace
+{
+
+/// Prepended to every datagram. The publication timestamp travels with the transfer so the subscriber can compute the
+/// latency without sharing state with the publisher.
+struct FrameHeader
+{
+    uint32_t transfer_id;
+    uint32_t frame_index;  ///< The most significant bit marks the last frame of the transfer.
+    uint64_t published_ns;
+};
+
+struct Ack
+{
+    uint32_t transfer_id;
+    uint32_t ok;
+};
+
+constexpr uint32_t EndOfTransfer  = 1UL << 31U;
+constexpr uint32_t StopTransferId = 0xFFFFFFFFUL;
+
+/// Consecutive receive timeouts after which the subscriber gives up (UDP only).
+constexpr unsigned MaxConsecutiveTimeouts = 20U;
+
+struct LoopbackOptions
+{
+    bool        udp;
+    std::size_t mtu;
+};
+
+/// A unidirectional datagram channel: frames written to tx are read from rx.
+struct Channel
+{
+    int tx;
+    int rx;
+};
+
+void closeChannel(Channel& channel)
+{
+    if (channel.tx >= 0)
+    {
+        (void) close(channel.tx);
+    }
+    if (channel.rx >= 0 && channel.rx != channel.tx)
+    {
+        (void) close(channel.rx);
+    }
+    channel.tx = -1;
+    channel.rx = -1;
+}
+
+bool openUnixChannel(Channel& out_channel)
+{
+    int fds[2] = {-1, -1};
+    if (socketpair(AF_UNIX, SOCK_DGRAM, 0, fds) != 0)
+    {
+        std::perror("socketpair");
+        return false;
+    }
+    out_channel.tx = fds[0];
+    out_channel.rx = fds[1];
+    return true;
+}
+
+bool openUdpChannel(Channel& out_channel)
+{
+    out_channel.rx = socket(AF_INET, SOCK_DGRAM, 0);
+    out_channel.tx = socket(AF_INET, SOCK_DGRAM, 0);
+    if (out_channel.rx < 0 || out_channel.tx < 0)
+    {
+        std::perror("socket");
+        closeChannel(out_channel);
+        return false;
+    }
+    // Best effort; the kernel clamps this to net.core.rmem_max.
+    const int receive_buffer_bytes = 8 * 1024 * 1024;
+    (void) setsockopt(out_channel.rx, SOL_SOCKET, SO_RCVBUF, &receive_buffer_bytes, sizeof(receive_buffer_bytes));
+
+    sockaddr_in address{};
+    address.sin_family      = AF_INET;
+    address.sin_port        = 0;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t address_size  = sizeof(address);
+    if (bind(out_channel.rx, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+        getsockname(out_channel.rx, reinterpret_cast<sockaddr*>(&address), &address_size) != 0 ||
+        connect(out_channel.tx, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        std::perror("udp loopback");
+        closeChannel(out_channel);
+        return false;
+    }
+    return true;
+}
+
+bool openChannel(const LoopbackOptions& options, Channel& out_channel)
+{
+    out_channel.tx = -1;
+    out_channel.rx = -1;
+    return options.udp ? openUdpChannel(out_channel) : openUnixChannel(out_channel);
+}
+
+void setReceiveTimeout(const int fd, const long timeout_ms)
+{
+    timeval timeout{};
+    timeout.tv_sec  = timeout_ms / 1000L;
+    timeout.tv_usec = (timeout_ms % 1000L) * 1000L;
+    (void) setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+}
+
+bool sendFrame(const int fd, const FrameHeader& header, const uint8_t* const payload, const std::size_t payload_size)
+{
+    iovec parts[2];
+    parts[0].iov_base = const_cast<FrameHeader*>(&header);
+    parts[0].iov_len  = sizeof(header);
+    parts[1].iov_base = const_cast<uint8_t*>(payload);
+    parts[1].iov_len  = payload_size;
+    msghdr message{};
+    message.msg_iov    = parts;
+    message.msg_iovlen = 2;
+    return sendmsg(fd, &message, 0) == static_cast<ssize_t>(sizeof(header) + payload_size);
+}
+
+/// Splits one serialized transfer into frames and sends them. A transfer always has at least one frame.
+bool publish(const int              fd,
+             const uint32_t         transfer_id,
+             const uint64_t         published_ns,
+             const uint8_t* const   payload,
+             const std::size_t      payload_size,
+             const std::size_t      mtu)
+{
+    std::size_t offset = 0;
+    uint32_t    index  = 0;
+    do
+    {
+        const std::size_t chunk = std::min(mtu, payload_size - offset);
+        const bool        last  = (offset + chunk) == payload_size;
+        const FrameHeader header{transfer_id, index | (last ? EndOfTransfer : 0U), published_ns};
+        if (!sendFrame(fd, header, payload + offset, chunk))
+        {
+            std::perror("sendmsg");
+            return false;
+        }
+        offset += chunk;
+        ++index;
+    } while (offset < payload_size);
+    return true;
+}
+
+struct SubscriberStats
+{
+    std::vector<uint64_t> latencies_ns;
+    bool                  failed;
+};
+
+void sendAck(const int fd, const uint32_t transfer_id, const bool ok)
+{
+    const Ack ack{transfer_id, ok ? 1U : 0U};
+    (void) send(fd, &ack, sizeof(ack), 0);
+}
+
+/// Reassembles transfers directly into the receive buffer (the payload of each frame is scattered to its final
+/// offset by recvmsg), deserializes them and acknowledges each transfer, positively or negatively. Runs until the
+/// publisher sends the stop frame or, over UDP, until the publisher has been silent for too long.
+template <typename T>
+void subscribe(const Channel& data, const Channel& acks, const LoopbackOptions& options, SubscriberStats& stats)
+{
+    std::unique_ptr<T>   obj{new T{}};
+    std::vector<uint8_t> buffer(T::_traits_::SerializationBufferSizeBytes + options.mtu);
+    std::size_t          offset      = 0;
+    uint32_t             transfer_id = 0;
+    uint32_t             next_index  = 0;
+    bool                 assembling  = false;
+    unsigned             timeouts    = 0;
+
+    const auto drop = [&]() {
+        if (assembling)
+        {
+            sendAck(acks.tx, transfer_id, false);
+        }
+        assembling = false;
+        offset     = 0;
+    };
+
+    for (;;)
+    {
+        FrameHeader header{};
+        iovec       parts[2];
+        parts[0].iov_base = &header;
+        parts[0].iov_len  = sizeof(header);
+        parts[1].iov_base = buffer.data() + offset;
+        parts[1].iov_len  = std::min(options.mtu, buffer.size() - offset);
+        msghdr message{};
+        message.msg_iov    = parts;
+        message.msg_iovlen = 2;
+        const ssize_t received = recvmsg(data.rx, &message, 0);
+        if (received < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                std::perror("recvmsg");
+                stats.failed = true;
+                return;
+            }
+            if (++timeouts >= MaxConsecutiveTimeouts)
+            {
+                return;
+            }
+            drop();
+            continue;
+        }
+        timeouts = 0;
+        if (static_cast<std::size_t>(received) < sizeof(header) || (message.msg_flags & MSG_TRUNC) != 0)
+        {
+            drop();
+            continue;
+        }
+        if (header.transfer_id == StopTransferId)
+        {
+            break;
+        }
+        const std::size_t chunk = static_cast<std::size_t>(received) - sizeof(header);
+        const uint32_t    index = header.frame_index & ~EndOfTransfer;
+        if (index == 0U)
+        {
+            // A new transfer while another was still being reassembled means the previous one lost its tail.
+            const std::size_t landed_at = offset;
+            drop();
+            if (landed_at != 0U)
+            {
+                std::memmove(buffer.data(), buffer.data() + landed_at, chunk);
+            }
+            assembling  = true;
+            transfer_id = header.transfer_id;
+            next_index  = 0;
+        }
+        if (!assembling || header.transfer_id != transfer_id || index != next_index)
+        {
+            drop();
+            continue;
+        }
+        offset += chunk;
+        ++next_index;
+        if ((header.frame_index & EndOfTransfer) != 0U)
+        {
+            const auto result = deserialize(*obj, nunavut::support::const_bitspan{buffer.data(), offset});
+            stats.latencies_ns.push_back(benchNowNs() - header.published_ns);
+            if (!result)
+            {
+                std::fprintf(stderr, "deserialization failed\n");
+                stats.failed = true;
+            }
+            sendAck(acks.tx, transfer_id, static_cast<bool>(result));
+            assembling = false;
+            offset     = 0;
+        }
+    }
+}
+
+/// Nearest-rank percentile of a sorted sample, in microseconds.
+double percentileUs(const std::vector<uint64_t>& sorted_ns, const double fraction)
+{
+    if (sorted_ns.empty())
+    {
+        return 0.0;
+    }
+    const double      rank  = std::ceil(fraction * static_cast<double>(sorted_ns.size()));
+    const std::size_t index = (rank < 1.0) ? 0U : static_cast<std::size_t>(rank) - 1U;
+    return static_cast<double>(sorted_ns[std::min(index, sorted_ns.size() - 1U)]) / 1000.0;
+}
+
+void printHeader()
+{
+    std::printf("%-48s %-4s %10s %9s %6s %10s %10s %10s %10s %10s %10s\n",
+                "type",
+                "via",
+                "bytes",
+                "transfers",
+                "lost",
+                "p50 us",
+                "p99 us",
+                "p99.9 us",
+                "max us",
+                "msg/s",
+                "MB/s");
+}
+
+/// Each transfer makes a full round trip, so unlike bench_serialization the count is capped to keep the run short.
+uint64_t iterationsFor(const BenchOptions& options, const std::size_t serialized_size)
+{
+    if (options.iterations > 0U)
+    {
+        return options.iterations;
+    }
+    const uint64_t budget_bytes = 256ULL * 1024ULL * 1024ULL;
+    const uint64_t iterations   = budget_bytes / std::max<uint64_t>(serialized_size, 1U);
+    return std::min<uint64_t>(std::max<uint64_t>(iterations, 50U), 20000U);
+}
+
+template <typename T>
+bool benchType(const char* const type_name, const BenchOptions& options, const LoopbackOptions& loopback)
+{
+    if (options.list)
+    {
+        std::printf("%s\n", type_name);
+        return true;
+    }
+    if (!benchSelected(&options, type_name, nullptr))
+    {
+        return true;
+    }
+    // Heap allocated; some of the types are far too large for the stack. Variable-length arrays are filled to
+    // capacity so every type is measured at its largest serialized size.
+    std::unique_ptr<T>   obj{new T{}};
+    std::mt19937_64      rng{0x5EED};
+    std::vector<uint8_t> buffer(T::_traits_::SerializationBufferSizeBytes);
+    random_fill(*obj, rng, nunavut::support::RandomArrayLength::Full);
+    const auto probe = serialize(*obj, nunavut::support::bitspan{buffer.data(), buffer.size()});
+    if (!probe)
+    {
+        std::fprintf(stderr, "%s: serialization failed\n", type_name);
+        return false;
+    }
+    const std::size_t serialized_size = *probe;
+    const uint64_t    iterations      = iterationsFor(options, serialized_size);
+
+    Channel data{-1, -1};
+    Channel acks{-1, -1};
+    if (!openChannel(loopback, data) || !openChannel(loopback, acks))
+    {
+        closeChannel(data);
+        return false;
+    }
+    if (loopback.udp)
+    {
+        setReceiveTimeout(data.rx, 100L);
+        setReceiveTimeout(acks.rx, 1000L);
+    }
+
+    SubscriberStats stats{{}, false};
+    stats.latencies_ns.reserve(static_cast<std::size_t>(iterations));
+    std::thread subscriber{[&]() { subscribe<T>(data, acks, loopback, stats); }};
+
+    bool           ok    = true;
+    uint64_t       lost  = 0;
+    const uint64_t start = benchNowNs();
+    for (uint64_t i = 0; (i < iterations) && ok; ++i)
+    {
+        const auto     transfer_id  = static_cast<uint32_t>(i);
+        const uint64_t published_ns = benchNowNs();
+        const auto     result       = serialize(*obj, nunavut::support::bitspan{buffer.data(), buffer.size()});
+        ok = result && publish(data.tx, transfer_id, published_ns, buffer.data(), *result, loopback.mtu);
+        // Acknowledgements of transfers that were given up on may arrive late; skip them. Over UDP a transfer that
+        // is never acknowledged (all of its frames were dropped) times out and is counted as lost.
+        Ack ack{StopTransferId, 0U};
+        while (ok && ack.transfer_id != transfer_id)
+        {
+            if (recv(acks.rx, &ack, sizeof(ack), 0) != static_cast<ssize_t>(sizeof(ack)))
+            {
+                ack.transfer_id = transfer_id;
+                ack.ok          = 0U;
+                if (!loopback.udp)
+                {
+                    std::perror("recv");
+                    ok = false;
+                }
+            }
+        }
+        lost += (ack.ok == 0U) ? 1U : 0U;
+    }
+    const uint64_t elapsed = benchNowNs() - start;
+    (void) publish(data.tx, StopTransferId, 0U, buffer.data(), 0U, loopback.mtu);
+    subscriber.join();
+    closeChannel(data);
+    closeChannel(acks);
+
+    ok = ok && !stats.failed;
+    std::vector<uint64_t>& latencies = stats.latencies_ns;
+    std::sort(latencies.begin(), latencies.end());
+    const double seconds = static_cast<double>(elapsed) / 1e9;
+    const double rate    = static_cast<double>(latencies.size()) / seconds;
+    std::printf("%-48s %-4s %10zu %9zu %6llu %10.1f %10.1f %10.1f %10.1f %10.0f %10.1f\n",
+                type_name,
+                loopback.udp ? "udp" : "unix",
+                serialized_size,
+                latencies.size(),
+                static_cast<unsigned long long>(lost),
+                percentileUs(latencies, 0.5),
+                percentileUs(latencies, 0.99),
+                percentileUs(latencies, 0.999),
+                percentileUs(latencies, 1.0),
+                rate,
+                rate * static_cast<double>(serialized_size) / 1e6);
+    return ok;
+}
+
+/// Removes the options specific to this benchmark from argv so the rest can go to benchParseOptions().
+bool parseLoopbackOptions(int& argc, char* argv[], LoopbackOptions& out_options)
+{
+    out_options.udp = false;
+    out_options.mtu = 1408U;
+    int kept        = 1;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--udp") == 0)
+        {
+            out_options.udp = true;
+        }
+        else if (std::strcmp(argv[i], "--mtu") == 0 && (i + 1) < argc)
+        {
+            out_options.mtu = static_cast<std::size_t>(std::strtoul(argv[++i], nullptr, 10));
+            if (out_options.mtu == 0U || out_options.mtu > 60000U)
+            {
+                std::fprintf(stderr, "--mtu must be in [1, 60000]\n");
+                return false;
+            }
+        }
+        else
+        {
+            argv[kept++] = argv[i];
+        }
+    }
+    argc = kept;
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    LoopbackOptions loopback;
+    BenchOptions    options;
+    if (!parseLoopbackOptions(argc, argv, loopback) || !benchParseOptions(argc, argv, &options))
+    {
+        return 2;
+    }
+    bool ok = true;
+
+    if (!options.list)
+    {
+        printHeader();
+    }
+    ok = benchType<regulated::basics::Primitive_0_1>("regulated::basics::Primitive_0_1", options, loopback) && ok;
+    ok = benchType<regulated::basics::PrimitiveArrayFixed_0_1>("regulated::basics::PrimitiveArrayFixed_0_1",
+                                                               options,
+                                                               loopback) &&
+         ok;
+    ok = benchType<regulated::basics::PrimitiveArrayVariable_0_1>("regulated::basics::PrimitiveArrayVariable_0_1",
+                                                                  options,
+                                                                  loopback) &&
+         ok;
+    ok = benchType<regulated::basics::Struct__0_1>("regulated::basics::Struct__0_1", options, loopback) && ok;
+    ok = benchType<regulated::basics::Union_0_1>("regulated::basics::Union_0_1", options, loopback) && ok;
+    ok = benchType<uavcan::node::Heartbeat_1_0>("uavcan::node::Heartbeat_1_0", options, loopback) && ok;
+    ok = benchType<regulated::RGB888_3840x2748_0_1>("regulated::RGB888_3840x2748_0_1", options, loopback) && ok;
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2024 OpenCyphal Development Team.
+ * This software is distributed under the terms of the MIT License.
+ *
+ * Serialization micro-benchmarks for generated C++ types. Not part of test_all; build and run with the
+ * bench_serialization target (or run_bench_serialization). Pass --perf to collect hardware performance counters.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+#include "regulated/basics/Primitive_0_1.hpp"
+#include "regulated/basics/PrimitiveArrayFixed_0_1.hpp"
+#include "regulated/basics/PrimitiveArrayVariable_0_1.hpp"
+#include "regulated/basics/Struct__0_1.hpp"
+#include "regulated/basics/Union_0_1.hpp"
+#include "regulated/RGB888_3840x2748_0_1.hpp"
+#include "uavcan/node/Heartbeat_1_0.hpp"
+#include "bench_helpers.h"
+
+namespace
+{
+
+template <typename T>
+bool benchType(const char* const type_name, const BenchOptions& options)
+{
+    if (options.list)
+    {
+        std::printf("%s\n", type_name);
+        return true;
+    }
+    if (!benchSelected(&options, type_name, nullptr))
+    {
+        return true;
+    }
+    // Heap allocated; some of the types are far too large for the stack. Variable-length arrays are filled to
+    // capacity so every type is measured at its largest serialized size.
+    std::unique_ptr<T>   obj{new T{}};
+    std::mt19937_64      rng{0x5EED};
+    std::vector<uint8_t> buffer(T::_traits_::SerializationBufferSizeBytes);
+    random_fill(*obj, rng, nunavut::support::RandomArrayLength::Full);
+    const uint64_t       iterations = benchIterationsFor(&options, buffer.size());
+    BenchPerfCounters    counters;
+    benchPerfOpen(&counters, options.perf);
+
+    // Warm-up and input for deserialization.
+    auto result = serialize(*obj, nunavut::support::bitspan{buffer.data(), buffer.size()});
+    if (result && benchSelected(&options, type_name, "ser"))
+    {
+        const uint64_t start = benchNowNs();
+        benchPerfStart(&counters);
+        for (uint64_t i = 0; (i < iterations) && result; ++i)
+        {
+            result = serialize(*obj, nunavut::support::bitspan{buffer.data(), buffer.size()});
+        }
+        benchPerfStop(&counters);
+        const uint64_t elapsed = benchNowNs() - start;
+        if (result)
+        {
+            benchPrintResult(type_name, "ser", iterations, elapsed, &counters);
+        }
+    }
+    if (!result)
+    {
+        std::fprintf(stderr, "%s: serialization failed\n", type_name);
+    }
+    else if (benchSelected(&options, type_name, "deser"))
+    {
+        const std::size_t serialized_size = *result;
+        const uint64_t    start           = benchNowNs();
+        benchPerfStart(&counters);
+        for (uint64_t i = 0; (i < iterations) && result; ++i)
+        {
+            result = deserialize(*obj, nunavut::support::const_bitspan{buffer.data(), serialized_size});
+        }
+        benchPerfStop(&counters);
+        const uint64_t elapsed = benchNowNs() - start;
+        if (result)
+        {
+            benchPrintResult(type_name, "deser", iterations, elapsed, &counters);
+        }
+        else
+        {
+            std::fprintf(stderr, "%s: deserialization failed\n", type_name);
+        }
+    }
+    benchPerfClose(&counters);
+    return static_cast<bool>(result);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    BenchOptions options;
+    if (!benchParseOptions(argc, argv, &options))
+    {
+        return 2;
+    }
+    bool ok = true;
+
+    if (!options.list)
+    {
+        benchPrintHeader();
+    }
+    ok = benchType<regulated::basics::Primitive_0_1>("regulated::basics::Primitive_0_1", options) && ok;
+    ok = benchType<regulated::basics::PrimitiveArrayFixed_0_1>("regulated::basics::PrimitiveArrayFixed_0_1", options) &&
+         ok;
+    ok = benchType<regulated::basics::PrimitiveArrayVariable_0_1>("regulated::basics::PrimitiveArrayVariable_0_1",
+                                                                  options) &&
+         ok;
+    ok = benchType<regulated::basics::Struct__0_1>("regulated::basics::Struct__0_1", options) && ok;
+    ok = benchType<regulated::basics::Union_0_1>("regulated::basics::Union_0_1", options) && ok;
+    ok = benchType<uavcan::node::Heartbeat_1_0>("uavcan::node::Heartbeat_1_0", options) && ok;
+    ok = benchType<regulated::RGB888_3840x2748_0_1>("regulated::RGB888_3840x2748_0_1", options) && ok;
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
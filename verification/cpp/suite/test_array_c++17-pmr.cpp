@@ -10,6 +10,7 @@
 #include "gmock/gmock.h"
 #include "mymsgs/Inner_1_0.hpp"
 #include "mymsgs/InnerMore_1_0.hpp"
+#include "mymsgs/InnerUnion_1_0.hpp"
 #include "mymsgs/Outer_1_0.hpp"
 #include "mymsgs/OuterMore_1_0.hpp"
 
@@ -148,3 +149,126 @@ TEST(StdVectorTests, TestAllocatorIsPassedDown) {
     // Verify that the allocator got passed down from the OuterMore_1_0 to the InnerMore_1_0
     ASSERT_EQ(outer.inners[0].inner_items.get_allocator().resource(), outer.outer_items.get_allocator().resource());
 }
+
+/**
+ * Verify that std::pmr::polymorphic_allocator gets passed down to union alternatives
+ */
+TEST(StdVectorTests, TestAllocatorIsPassedToUnionAlternatives) {
+    std::array<std::byte, 500> buffer{};
+    std::pmr::monotonic_buffer_resource mbr{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+    std::pmr::polymorphic_allocator<void> pa{&mbr};
+
+    // The default alternative is constructed using the allocator
+    mymsgs::InnerUnion_1_0 union1{pa};
+    ASSERT_TRUE(union1.is_inner());
+    ASSERT_EQ(union1.get_inner().inner_items.get_allocator().resource(), &mbr);
+
+    // ...and so are the alternatives selected later
+    union1.set_items().push_back(42);
+    ASSERT_TRUE(union1.is_items());
+    ASSERT_EQ(union1.get_items().get_allocator().resource(), &mbr);
+
+    // ...and the alternatives created while deserializing
+    std::array<unsigned char, mymsgs::InnerUnion_1_0::_traits_::SerializationBufferSizeBytes> roundtrip_buffer{};
+    nunavut::support::bitspan ser_buffer(roundtrip_buffer);
+    ASSERT_TRUE(serialize(union1, ser_buffer));
+
+    mymsgs::InnerUnion_1_0 union2{pa};
+    union2.set_flag(true);
+    nunavut::support::const_bitspan des_buffer(static_cast<const unsigned char*>(roundtrip_buffer.data()), roundtrip_buffer.size());
+    ASSERT_TRUE(deserialize(union2, des_buffer));
+    ASSERT_TRUE(union2.is_items());
+    ASSERT_EQ(union2.get_items().size(), 1);
+    ASSERT_EQ(union2.get_items()[0], 42);
+    ASSERT_EQ(union2.get_items().get_allocator().resource(), &mbr);
+}
+
+/**
+ * Verify that copying, moving, and assigning a union constructs the active alternative with the allocator of the
+ * destination rather than copying the allocator of the source
+ */
+TEST(StdVectorTests, TestUnionAlternativeUsesDestinationAllocator) {
+    std::array<std::byte, 500> source_buffer{};
+    std::pmr::monotonic_buffer_resource source_mbr{source_buffer.data(), source_buffer.size(), std::pmr::null_memory_resource()};
+    std::array<std::byte, 500> destination_buffer{};
+    std::pmr::monotonic_buffer_resource destination_mbr{destination_buffer.data(), destination_buffer.size(), std::pmr::null_memory_resource()};
+    std::pmr::polymorphic_allocator<void> source_pa{&source_mbr};
+    std::pmr::polymorphic_allocator<void> destination_pa{&destination_mbr};
+
+    mymsgs::InnerUnion_1_0 source{source_pa};
+    source.set_items().push_back(42);
+
+    // Copy with allocator
+    mymsgs::InnerUnion_1_0 copied{source, destination_pa};
+    ASSERT_TRUE(copied.is_items());
+    ASSERT_EQ(copied.get_items().size(), 1);
+    ASSERT_EQ(copied.get_items().get_allocator().resource(), &destination_mbr);
+    ASSERT_EQ(source.get_items().get_allocator().resource(), &source_mbr);
+
+    // Move with allocator
+    mymsgs::InnerUnion_1_0 moved{mymsgs::InnerUnion_1_0{source}, destination_pa};
+    ASSERT_TRUE(moved.is_items());
+    ASSERT_EQ(moved.get_items()[0], 42);
+    ASSERT_EQ(moved.get_items().get_allocator().resource(), &destination_mbr);
+
+    // Copy assignment, both to a different and to the same alternative
+    mymsgs::InnerUnion_1_0 assigned{destination_pa};
+    assigned = source;
+    ASSERT_TRUE(assigned.is_items());
+    ASSERT_EQ(assigned.get_items()[0], 42);
+    ASSERT_EQ(assigned.get_items().get_allocator().resource(), &destination_mbr);
+    assigned = source;
+    ASSERT_EQ(assigned.get_items().get_allocator().resource(), &destination_mbr);
+
+    // Move assignment
+    mymsgs::InnerUnion_1_0 move_assigned{destination_pa};
+    move_assigned = mymsgs::InnerUnion_1_0{source};
+    ASSERT_TRUE(move_assigned.is_items());
+    ASSERT_EQ(move_assigned.get_items()[0], 42);
+    ASSERT_EQ(move_assigned.get_items().get_allocator().resource(), &destination_mbr);
+
+    // Composite alternatives get the allocator as well
+    source.set_inner().inner_items.push_back(7);
+    mymsgs::InnerUnion_1_0 inner_copied{source, destination_pa};
+    ASSERT_TRUE(inner_copied.is_inner());
+    ASSERT_EQ(inner_copied.get_inner().inner_items.get_allocator().resource(), &destination_mbr);
+    assigned = source;
+    ASSERT_TRUE(assigned.is_inner());
+    ASSERT_EQ(assigned.get_inner().inner_items.get_allocator().resource(), &destination_mbr);
+}
+
+/**
+ * Move-assigning a union between objects using different memory resources copies the alternative into the
+ * destination's resource, which may allocate, so the move assignment must not be noexcept.
+ */
+TEST(StdVectorTests, TestUnionMoveAssignBetweenResources) {
+    static_assert(!std::is_nothrow_move_assignable<mymsgs::InnerUnion_1_0>::value,
+                  "Move assignment may allocate when the resources differ.");
+
+    std::array<std::byte, 500> source_buffer{};
+    std::pmr::monotonic_buffer_resource source_mbr{source_buffer.data(), source_buffer.size(), std::pmr::null_memory_resource()};
+    std::array<std::byte, 500> destination_buffer{};
+    std::pmr::monotonic_buffer_resource destination_mbr{destination_buffer.data(), destination_buffer.size(), std::pmr::null_memory_resource()};
+
+    mymsgs::InnerUnion_1_0 source{std::pmr::polymorphic_allocator<void>{&source_mbr}};
+    source.set_items().push_back(42);
+    source.get_items().push_back(43);
+
+    mymsgs::InnerUnion_1_0 destination{std::pmr::polymorphic_allocator<void>{&destination_mbr}};
+    destination = std::move(source);
+    ASSERT_TRUE(destination.is_items());
+    ASSERT_EQ(destination.get_items().size(), 2);
+    ASSERT_EQ(destination.get_items()[0], 42);
+    ASSERT_EQ(destination.get_items()[1], 43);
+    ASSERT_EQ(destination.get_items().get_allocator().resource(), &destination_mbr);
+    ASSERT_TRUE(source.is_items());
+    ASSERT_EQ(source.get_items().get_allocator().resource(), &source_mbr);
+#if defined(__cpp_exceptions)
+    // A destination that cannot allocate reports it instead of terminating.
+    std::pmr::monotonic_buffer_resource empty_mbr{std::pmr::null_memory_resource()};
+    mymsgs::InnerUnion_1_0 starved{std::pmr::polymorphic_allocator<void>{&empty_mbr}};
+    mymsgs::InnerUnion_1_0 other{std::pmr::polymorphic_allocator<void>{&source_mbr}};
+    other.set_items().push_back(44);
+    ASSERT_THROW(starved = std::move(other), std::bad_alloc);
+#endif
+}
@@ -341,6 +341,21 @@ TEST(BitSpan, SetIxx_bufferOverflow)
     ASSERT_EQ(0xAA, buffer[2]);
 }
 
+TEST(BitSpan, SetDelimiterHeader)
+{
+    uint8_t buffer[] = {0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xAA};
+    nunavut::support::bitspan sp{buffer, sizeof(buffer), 2U * 8U};
+    sp.setDelimiterHeader(0x12345678UL);
+    ASSERT_EQ(0xAA, buffer[1]);
+    ASSERT_EQ(0x78, buffer[2]);
+    ASSERT_EQ(0x56, buffer[3]);
+    ASSERT_EQ(0x34, buffer[4]);
+    ASSERT_EQ(0x12, buffer[5]);
+    ASSERT_EQ(0xAA, buffer[6]);
+    // The offset is left where it was; the caller moves past the header.
+    ASSERT_EQ(2U * 8U, sp.offset());
+}
+
 // +--------------------------------------------------------------------------+
 // | nunavut[Get|Set]Bit
 // +--------------------------------------------------------------------------+
@@ -4,7 +4,10 @@
  * Sanity tests.
  */
 #include "gmock/gmock.h"
+#include <type_traits>
 #include "uavcan/time/TimeSystem_0_1.hpp"
+#include "uavcan/primitive/String_1_0.hpp"
+#include "uavcan/_register/Value_1_0.hpp"
 
 /**
  * Temporary test as a placeholder while we wire up the build.
@@ -14,3 +17,32 @@ TEST(GeneralTests, DoesSomethingCompile) {
     a.value = 1;
     ASSERT_EQ(1, a.value);
 }
+
+/**
+ * Generated types must be nothrow move-constructible when their fields are so that containers move, rather than
+ * copy, them on reallocation. Swap must be found by ADL and be noexcept exactly when moving never throws.
+ */
+TEST(GeneralTests, NothrowMoveAndSwap) {
+    static_assert(std::is_nothrow_move_constructible<uavcan::time::TimeSystem_0_1>::value,
+                  "Primitive-only types must be nothrow move-constructible.");
+    static_assert(std::is_nothrow_move_constructible<uavcan::primitive::String_1_0>::value,
+                  "Types with variable-length arrays must be nothrow move-constructible.");
+    static_assert(std::is_nothrow_move_constructible<uavcan::_register::Value_1_0>::value,
+                  "Union types must be nothrow move-constructible.");
+
+    using std::swap;
+    uavcan::_register::Value_1_0 a;
+    uavcan::_register::Value_1_0 b;
+    static_assert(noexcept(swap(a, b)) ==
+                      (std::is_nothrow_move_constructible<uavcan::_register::Value_1_0>::value &&
+                       std::is_nothrow_move_assignable<uavcan::_register::Value_1_0>::value),
+                  "swap must be noexcept exactly when moving is.");
+
+    a.set_string().value.push_back(42);
+    b.set_natural8().value.push_back(7);
+    swap(a, b);
+    ASSERT_TRUE(a.is_natural8());
+    ASSERT_EQ(7, a.get_natural8().value[0]);
+    ASSERT_TRUE(b.is_string());
+    ASSERT_EQ(42, b.get_string().value[0]);
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2024 OpenCyphal Development Team.
+ * This software is distributed under the terms of the MIT License.
+ *
+ * Tests of deserialize_trusted(). Built against the types generated with --enable-trusted-deserialization.
+ */
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include "test_helpers.hpp"
+#include "regulated/basics/Struct__0_1.hpp"
+#include "regulated/basics/Primitive_0_1.hpp"
+#include "regulated/basics/PrimitiveArrayVariable_0_1.hpp"
+#include "regulated/basics/Union_0_1.hpp"
+
+/// Buffers written by serialize() are read back by deserialize_trusted(), which must consume exactly what was written.
+template<typename T, typename Rng>
+static void checkTrustedRoundTrip(Rng& rng)
+{
+    T ref;
+    random_fill(ref, rng);
+    std::array<uint8_t, T::_traits_::SerializationBufferSizeBytes> buf_a{};
+    const auto size_a = serialize(ref, buf_a);
+    ASSERT_TRUE(size_a);
+
+    T obj;
+    const auto size_consumed = deserialize_trusted(obj, {buf_a.data(), *size_a});
+    ASSERT_TRUE(size_consumed);
+    ASSERT_EQ(*size_a, *size_consumed);
+    std::array<uint8_t, T::_traits_::SerializationBufferSizeBytes> buf_b{};
+    const auto size_b = serialize(obj, buf_b);
+    ASSERT_TRUE(size_b);
+    ASSERT_EQ(*size_a, *size_b);
+    ASSERT_TRUE(std::equal(buf_a.begin(), buf_a.begin() + static_cast<std::ptrdiff_t>(*size_a), buf_b.begin()));
+}
+
+TEST(DeserializeTrusted, RoundTrip) {
+    std::mt19937 rng(static_cast<std::mt19937::result_type>(rand()));
+    for (int i = 0; i < 100; i++)
+    {
+        checkTrustedRoundTrip<regulated::basics::Primitive_0_1>(rng);
+        checkTrustedRoundTrip<regulated::basics::PrimitiveArrayVariable_0_1>(rng);
+        checkTrustedRoundTrip<regulated::basics::Struct__0_1>(rng);
+        checkTrustedRoundTrip<regulated::basics::Union_0_1>(rng);
+    }
+}
@@ -6,11 +6,19 @@
  * Tests of serialization
  */
 
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
 #include "test_helpers.hpp"
 #include "uavcan/time/TimeSystem_0_1.hpp"
 #include "regulated/basics/Struct__0_1.hpp"
 #include "regulated/basics/Service_0_1.hpp"
 #include "regulated/basics/Primitive_0_1.hpp"
+#include "regulated/basics/PrimitiveArrayVariable_0_1.hpp"
+#include "regulated/basics/Union_0_1.hpp"
+#include "regulated/delimited/A_1_1.hpp"
+#include "uavcan/primitive/Unstructured_1_0.hpp"
 
 
 static_assert(
@@ -83,6 +91,168 @@ TEST(Serialization, BasicSerialize) {
     }
 }
 
+TEST(Serialization, SerializeToGrowableSink) {
+    regulated::basics::Struct__0_1 obj;
+    obj.bytes_lt3.push_back(111);
+    obj.bytes_lt3.push_back(222);
+
+    std::array<uint8_t, regulated::basics::Struct__0_1::_traits_::SerializationBufferSizeBytes> buffer{};
+    const auto expected = serialize(obj, buffer);
+    ASSERT_TRUE(expected);
+
+    // The sink starts empty and is grown only as far as needed.
+    std::vector<uint8_t> sink;
+    const auto result = serialize(obj, sink);
+    ASSERT_TRUE(result);
+    ASSERT_EQ(*expected, *result);
+    ASSERT_EQ(*result, sink.size());
+    ASSERT_LT(sink.capacity(), regulated::basics::Struct__0_1::_traits_::SerializationBufferSizeBytes);
+    ASSERT_TRUE(std::equal(sink.begin(), sink.end(), buffer.begin()));
+}
+
+/// An object larger than the initial sink buffer grows the sink by doubling rather than to the worst case.
+TEST(Serialization, SerializeToGrowableSinkDoubles) {
+    uavcan::primitive::Unstructured_1_0 obj;
+    for (std::uint8_t i = 0U; i < 100U; ++i)
+    {
+        obj.value.push_back(i);
+    }
+    ASSERT_LT(nunavut::support::SinkInitialSizeBytes, 102U);
+
+    std::vector<uint8_t> sink;
+    const auto result = serialize(obj, sink);
+    ASSERT_TRUE(result) << "Error is " << result.error();
+    ASSERT_EQ(102U, *result);
+    ASSERT_EQ(102U, sink.size());
+    ASSERT_LE(sink.capacity(), 2U * nunavut::support::SinkInitialSizeBytes);
+    ASSERT_LT(sink.capacity(), uavcan::primitive::Unstructured_1_0::_traits_::SerializationBufferSizeBytes);
+    ASSERT_EQ(100U, sink[0]);
+    ASSERT_EQ(0U, sink[1]);
+    ASSERT_EQ(99U, sink[101]);
+}
+
+/// A buffer only has to be large enough for the object at hand, not for the worst case of its type.
+TEST(Serialization, SerializeIntoBufferSmallerThanWorstCase) {
+    regulated::basics::Struct__0_1 obj;
+    obj.bytes_lt3.push_back(111);
+
+    std::array<uint8_t, regulated::basics::Struct__0_1::_traits_::SerializationBufferSizeBytes> buffer{};
+    const auto expected = serialize(obj, buffer);
+    ASSERT_TRUE(expected);
+    ASSERT_LT(*expected, buffer.size());
+
+    std::array<uint8_t, regulated::basics::Struct__0_1::_traits_::SerializationBufferSizeBytes> exact{};
+    const auto result = serialize(obj, nunavut::support::bitspan{exact.data(), *expected});
+    ASSERT_TRUE(result) << "Error is " << result.error();
+    ASSERT_EQ(*expected, *result);
+    ASSERT_TRUE(std::equal(exact.begin(), exact.begin() + static_cast<std::ptrdiff_t>(*result), buffer.begin()));
+
+    const auto too_small = serialize(obj, nunavut::support::bitspan{exact.data(), *expected - 1U});
+    ASSERT_FALSE(too_small);
+    ASSERT_EQ(nunavut::support::Error::SerializationBufferTooSmall, too_small.error());
+}
+
+/// Randomly filled objects serialize without error and survive a round trip. The serialized forms are compared.
+template<typename T, typename Rng>
+static void checkRandomRoundTrip(Rng& rng, const nunavut::support::RandomArrayLength array_length)
+{
+    T ref;
+    random_fill(ref, rng, array_length);
+    std::array<uint8_t, T::_traits_::SerializationBufferSizeBytes> buf_a{};
+    const auto size_a = serialize(ref, buf_a);
+    ASSERT_TRUE(size_a);
+
+    T obj;
+    ASSERT_TRUE(deserialize(obj, {buf_a.data(), *size_a}));
+    std::array<uint8_t, T::_traits_::SerializationBufferSizeBytes> buf_b{};
+    const auto size_b = serialize(obj, buf_b);
+    ASSERT_TRUE(size_b);
+    ASSERT_EQ(*size_a, *size_b);
+    ASSERT_TRUE(std::equal(buf_a.begin(), buf_a.begin() + static_cast<std::ptrdiff_t>(*size_a), buf_b.begin()));
+}
+
+TEST(Serialization, RandomFillRoundTrip) {
+    std::mt19937 rng(static_cast<std::mt19937::result_type>(rand()));
+    for (const auto array_length : {nunavut::support::RandomArrayLength::Uniform,
+                                    nunavut::support::RandomArrayLength::Short,
+                                    nunavut::support::RandomArrayLength::Empty,
+                                    nunavut::support::RandomArrayLength::Full})
+    {
+        for (int i = 0; i < 100; i++)
+        {
+            checkRandomRoundTrip<regulated::basics::Primitive_0_1>(rng, array_length);
+            checkRandomRoundTrip<regulated::basics::PrimitiveArrayVariable_0_1>(rng, array_length);
+            checkRandomRoundTrip<regulated::basics::Struct__0_1>(rng, array_length);
+            checkRandomRoundTrip<regulated::basics::Union_0_1>(rng, array_length);
+        }
+    }
+}
+
+/// Serializes a fully populated object into every buffer size from zero to the worst case. Buffers smaller than the
+/// serialized size are rejected, larger ones produce the same bytes, and nothing is ever written past the buffer.
+template<typename T, typename Rng>
+static void checkEveryBufferSize(Rng& rng)
+{
+    constexpr std::size_t GuardBytes = 8U;
+    constexpr std::uint8_t GuardValue = 0xA5U;
+    T obj;
+    random_fill(obj, rng, nunavut::support::RandomArrayLength::Full);
+    std::array<uint8_t, T::_traits_::SerializationBufferSizeBytes> reference{};
+    const auto expected = serialize(obj, reference);
+    ASSERT_TRUE(expected);
+
+    for (std::size_t size = 0U; size <= T::_traits_::SerializationBufferSizeBytes; size++)
+    {
+        std::array<uint8_t, T::_traits_::SerializationBufferSizeBytes + GuardBytes> buffer{};
+        buffer.fill(GuardValue);
+        const auto result = serialize(obj, nunavut::support::bitspan{buffer.data(), size});
+        if (size < *expected)
+        {
+            ASSERT_FALSE(result) << "Buffer size " << size;
+            ASSERT_EQ(nunavut::support::Error::SerializationBufferTooSmall, result.error());
+        }
+        else
+        {
+            ASSERT_TRUE(result) << "Buffer size " << size << ", error is " << result.error();
+            ASSERT_EQ(*expected, *result);
+            ASSERT_TRUE(std::equal(reference.begin(), reference.begin() + static_cast<std::ptrdiff_t>(*result),
+                                   buffer.begin()));
+        }
+        ASSERT_TRUE(std::all_of(buffer.begin() + static_cast<std::ptrdiff_t>(size), buffer.end(),
+                                [](const uint8_t b) { return b == GuardValue; }))
+            << "Buffer size " << size;
+    }
+}
+
+TEST(Serialization, EveryBufferSize) {
+    std::mt19937 rng(static_cast<std::mt19937::result_type>(rand()));
+    for (int i = 0; i < 10; i++)
+    {
+        checkEveryBufferSize<regulated::basics::Primitive_0_1>(rng);  // Sub-byte fields.
+        checkEveryBufferSize<regulated::basics::Struct__0_1>(rng);    // Void and dynamic padding, delimited fields.
+        checkEveryBufferSize<regulated::delimited::A_1_1>(rng);       // Delimited union.
+    }
+}
+
+TEST(Serialization, RandomFillRanges) {
+    std::mt19937_64 rng(static_cast<std::mt19937_64::result_type>(rand()));
+    for (int i = 0; i < 1000; i++)
+    {
+        regulated::basics::Primitive_0_1 obj;
+        random_fill(obj, rng);
+        ASSERT_LE(obj.a_u7, 127U);
+        ASSERT_GE(obj.a_i7, -64);
+        ASSERT_LE(obj.a_i7, 63);
+        ASSERT_TRUE(std::isfinite(obj.a_f16));
+        ASSERT_LE(std::fabs(obj.a_f16), 65504.0F);
+    }
+    regulated::basics::PrimitiveArrayVariable_0_1 obj;
+    random_fill(obj, rng, nunavut::support::RandomArrayLength::Full);
+    ASSERT_EQ(regulated::basics::PrimitiveArrayVariable_0_1::CAPACITY, obj.a_u64.size());
+    random_fill(obj, rng, nunavut::support::RandomArrayLength::Empty);
+    ASSERT_EQ(0U, obj.a_u64.size());
+}
+
 /// This was copied from C counterpart and modified for C++
 /// The reference array has been pedantically validated manually bit by bit (it did really took authors of
 /// C tests about three hours).
@@ -582,3 +752,72 @@ TEST(Serialization, CCppBackAndForth)
         EXPECT_FLOAT_EQ(c_parsed.inverter_temperature,              cpp_parsed.inverter_temperature);
     }
 }
+
+
+#include "regulated/zubax/actuator/esc/AngVelSetpoint_0_1.hpp"
+#include "regulated/zubax/sensor/bms/BatteryPackParams_0_1.hpp"
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#pragma GCC diagnostic ignored "-Wzero-as-null-pointer-constant"
+#include "regulated/zubax/actuator/esc/AngVelSetpoint_0_1.h"
+#pragma GCC diagnostic pop
+
+/// Arrays of sealed, fixed-size composites are serialized with a single capacity check and a constant stride.
+TEST(Serialization, FixedSizeCompositeArrays)
+{
+    using regulated::zubax::actuator::esc::AngVelSetpoint_0_1;
+    AngVelSetpoint_0_1 cpp_part;
+    for (uint32_t i = 0U; i < 63U; i++)
+    {
+        uavcan::si::unit::angular_velocity::Scalar_1_0 element;
+        element.radian_per_second = randF32();
+        cpp_part.motor_mechanical_angular_velocity.push_back(element);
+    }
+    uint8_t buf[AngVelSetpoint_0_1::_traits_::SerializationBufferSizeBytes]{};
+    const auto result = serialize(cpp_part, buf);
+    ASSERT_TRUE(result) << "Error is " << result.error();
+    ASSERT_EQ(1U + (63U * 4U), result.value());
+
+    // The C serializer has no such special case, so it serves as the reference.
+    regulated_zubax_actuator_esc_AngVelSetpoint_0_1 c_parsed;
+    size_t size = result.value();
+    ASSERT_EQ(NUNAVUT_SUCCESS, regulated_zubax_actuator_esc_AngVelSetpoint_0_1_deserialize_(&c_parsed, buf, &size));
+    ASSERT_EQ(63U, c_parsed.motor_mechanical_angular_velocity.count);
+    for (size_t i = 0U; i < 63U; i++)
+    {
+        EXPECT_FLOAT_EQ(cpp_part.motor_mechanical_angular_velocity[i].radian_per_second,
+                        c_parsed.motor_mechanical_angular_velocity.elements[i].radian_per_second);
+    }
+    uint8_t c_buf[sizeof(buf)]{};
+    size = sizeof(c_buf);
+    ASSERT_EQ(NUNAVUT_SUCCESS, regulated_zubax_actuator_esc_AngVelSetpoint_0_1_serialize_(&c_parsed, c_buf, &size));
+    ASSERT_EQ(result.value(), size);
+    ASSERT_TRUE(std::equal(std::begin(buf), std::begin(buf) + static_cast<std::ptrdiff_t>(size), std::begin(c_buf)));
+
+    // Too short for the array.
+    ASSERT_FALSE(serialize(cpp_part, nunavut::support::bitspan{buf, result.value() - 1U}));
+
+    // Larger than the first buffer a sink is given, so the sink is grown once.
+    std::vector<uint8_t> sink;
+    const auto sink_result = serialize(cpp_part, sink);
+    ASSERT_TRUE(sink_result) << "Error is " << sink_result.error();
+    ASSERT_EQ(result.value(), sink.size());
+    ASSERT_TRUE(std::equal(sink.begin(), sink.end(), std::begin(buf)));
+
+    // Fixed-length arrays take the same path.
+    std::mt19937 rng(static_cast<std::mt19937::result_type>(rand()));
+    for (int i = 0; i < 100; i++)
+    {
+        checkRandomRoundTrip<regulated::zubax::sensor::bms::BatteryPackParams_0_1>(
+            rng, nunavut::support::RandomArrayLength::Uniform);
+    }
+
+    // Elements are written by the internal unchecked serializer, which must agree with the public one.
+    const auto& element = cpp_part.motor_mechanical_angular_velocity[0];
+    uint8_t checked[uavcan::si::unit::angular_velocity::Scalar_1_0::_traits_::SerializationBufferSizeBytes]{};
+    uint8_t unchecked[sizeof(checked)]{};
+    ASSERT_EQ(sizeof(checked), serialize(element, checked).value());
+    ASSERT_EQ(sizeof(unchecked), _serialize_impl(element, unchecked).value());
+    ASSERT_TRUE(std::equal(std::begin(checked), std::end(checked), std::begin(unchecked)));
+}
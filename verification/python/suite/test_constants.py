@@ -26,3 +26,32 @@ def test_constants(compiled: list[GeneratedPackageInfo]) -> None:
             fpid_obj = get_fixed_port_id(dtype)
             fpid_mod = get_model(dtype).fixed_port_id
             assert (fpid_obj == fpid_mod) or (fpid_obj is None) or (fpid_mod is None)
+
+
+def test_lazy_model(compiled: list[GeneratedPackageInfo]) -> None:
+    import inspect
+    import os
+    import subprocess
+    import sys
+    from nunavut_support import get_class, get_extent_bytes, get_model, is_serializable
+
+    # Importing a type does not restore its model; run in a fresh interpreter to not depend on the test order.
+    code = (
+        "import inspect\n"
+        "from uavcan.node import Heartbeat_1_0, GetInfo_1_0\n"
+        "for cls in (Heartbeat_1_0, GetInfo_1_0, GetInfo_1_0.Request, GetInfo_1_0.Response):\n"
+        "    print(type(inspect.getattr_static(cls, '_MODEL_')).__name__)\n"
+    )
+    env = dict(os.environ, PYTHONPATH=os.pathsep.join(sys.path))
+    result = subprocess.run([sys.executable, "-c", code], env=env, capture_output=True, text=True, check=True)
+    assert result.stdout.split() == ["_LazyModel_"] * 4
+
+    for info in compiled:
+        for model in expand_service_types(info.models, keep_services=True):
+            dtype = get_class(model)
+            assert dtype._FULL_NAME_AND_VERSION_ == f"{model.full_name}.{model.version.major}.{model.version.minor}"
+            if is_serializable(dtype):
+                assert get_extent_bytes(dtype) * 8 == model.extent
+            # Once restored, the model replaces the lazy attribute in the class.
+            assert inspect.getattr_static(dtype, "_MODEL_") is get_model(dtype)
+            assert get_model(dtype()) is get_model(dtype)
@@ -0,0 +1,78 @@
+# Copyright (c) 2024 OpenCyphal
+# This software is distributed under the terms of the MIT License.
+
+from __future__ import annotations
+from typing import Any
+import numpy
+import pytest
+import pydsdl
+from .util import expand_service_types, make_random_object
+from .conftest import GeneratedPackageInfo
+
+
+_NUM_ITEMS = 10
+
+
+def test_deserialize_many(compiled: list[GeneratedPackageInfo]) -> None:
+    """
+    Every generated type that defines a structured dtype is decoded by deserialize_many() to the same values as
+    by deserialize(); the other types are rejected.
+    """
+    from nunavut_support import get_class, serialize, deserialize, deserialize_many
+
+    num_fixed = 0
+    for info in compiled:
+        for model in expand_service_types(info.models):
+            dtype = get_class(model)
+            if dtype._NUMPY_DTYPE_ is None:
+                with pytest.raises(TypeError):
+                    deserialize_many(dtype, [])
+                continue
+            num_fixed += 1
+            assert dtype._NUMPY_DTYPE_.itemsize * 8 == model.inner_type.bit_length_set.max
+            items = [b"".join(serialize(make_random_object(model))) for _ in range(_NUM_ITEMS)]
+            items.append(b"")  # Implicit zero extension.
+            items.append(items[0] + b"\xFF")  # Implicit truncation.
+            out = deserialize_many(dtype, items)
+            assert len(out) == len(items)
+            for row, item in zip(out, items):
+                reference = deserialize(dtype, [memoryview(item)])
+                assert reference is not None
+                _compare(model, reference, row)
+            columns = deserialize_many(dtype, items, columns=True)
+            assert isinstance(columns, dict)
+            assert list(columns) == [f.name for f in model.fields_except_padding]
+
+    assert num_fixed > 0
+
+
+def test_deserialize_many_empty(compiled: list[GeneratedPackageInfo]) -> None:
+    from nunavut_support import deserialize_many
+    from uavcan.primitive import Empty_1_0
+    from uavcan.si.unit.velocity import Vector3_1_0
+
+    del compiled
+    # A type without fields has no structured dtype.
+    assert Empty_1_0._NUMPY_DTYPE_ is None  # type: ignore
+    with pytest.raises(TypeError):
+        deserialize_many(Empty_1_0, [b""])
+
+    out = deserialize_many(Vector3_1_0, [numpy.array([1.0, -2.0, 3.5], dtype="<f4").tobytes()], columns=True)
+    assert isinstance(out, dict)
+    assert out["meters_per_second"].tolist() == [[1.0, -2.0, 3.5]]
+
+
+def _compare(model: pydsdl.CompositeType, reference: Any, row: Any) -> None:
+    from nunavut_support import get_attribute
+
+    for f in model.fields_except_padding:
+        expected = get_attribute(reference, f.name)
+        actual = row[f.name]
+        if isinstance(f.data_type, pydsdl.CompositeType):
+            _compare(f.data_type, expected, actual)
+        elif isinstance(f.data_type, pydsdl.ArrayType) and isinstance(f.data_type.element_type, pydsdl.CompositeType):
+            assert len(expected) == len(actual)
+            for e, a in zip(expected, actual):
+                _compare(f.data_type.element_type, e, a)
+        else:
+            numpy.testing.assert_array_equal(numpy.asarray(expected), actual, err_msg=f"{model}.{f.name}")
@@ -119,6 +119,25 @@ def test_manual_heartbeat(compiled: list[GeneratedPackageInfo]) -> None:
         set_attribute(obj, "nonexistent", 123)
 
 
+def test_slots(compiled: list[GeneratedPackageInfo]) -> None:
+    from nunavut_support import deserialize, serialize
+    import uavcan.node
+
+    del compiled
+
+    # The fields are held in __slots__, so there is no instance __dict__ to put other attributes into.
+    obj = uavcan.node.Heartbeat_1_0(uptime=123)
+    assert not hasattr(obj, "__dict__")
+    with pytest.raises(AttributeError):
+        obj.nonexistent = 123  # type: ignore
+    # Instances built by the deserializer bypass __init__() but are complete.
+    des = deserialize(uavcan.node.Heartbeat_1_0, [memoryview(b"".join(serialize(obj)))])
+    assert des is not None
+    assert not hasattr(des, "__dict__")
+    assert des.uptime == 123
+    assert repr(des) == repr(obj)
+
+
 def test_minor_alias(compiled: list[GeneratedPackageInfo]) -> None:
     from regulated.delimited import BDelimited_1, BDelimited_1_1, BDelimited_1_0
 
@@ -127,6 +146,29 @@ def test_minor_alias(compiled: list[GeneratedPackageInfo]) -> None:
     assert BDelimited_1 is BDelimited_1_1
 
 
+def test_lazy_namespace(compiled: list[GeneratedPackageInfo]) -> None:
+    import importlib
+    import os
+    import subprocess
+    import sys
+    import regulated.delimited
+
+    del compiled
+    assert "BDelimited_1" in dir(regulated.delimited)
+    assert "BDelimited_1" in regulated.delimited.__all__
+    with pytest.raises(AttributeError, match="Nonexistent_1_0"):
+        getattr(regulated.delimited, "Nonexistent_1_0")
+    # Importing a type module directly must not rebind the namespace attribute to the module.
+    importlib.import_module("regulated.delimited.BDelimited_1_0")
+    assert isinstance(regulated.delimited.BDelimited_1_0, type)
+
+    # Importing a namespace does not import its types; run in a fresh interpreter to not depend on the test order.
+    code = "import sys, uavcan.node; print(sorted(m for m in sys.modules if m.startswith('uavcan.node.')))"
+    env = dict(os.environ, PYTHONPATH=os.pathsep.join(sys.path))
+    result = subprocess.run([sys.executable, "-c", code], env=env, capture_output=True, text=True, check=True)
+    assert result.stdout.strip() == "[]"
+
+
 def test_delimited(compiled: list[GeneratedPackageInfo]) -> None:
     from nunavut_support import serialize, deserialize
     from regulated.delimited import A_1_0, A_1_1, BDelimited_1_0, BDelimited_1_1